@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
+#include <string.h>
+#include "array.h"
+#include "alignedAlloc.h"
 
 /**
  * 总的来看，数组的插入与删除操作有以下缺点:
@@ -59,6 +61,92 @@ void arrDelete(int* arr, int size, int index)
 }
 
 
+/**
+ * 批量插入
+ *
+ * 逐个调用 arrInsert 插入 k 个元素，每次都要移动插入位置之后的全部元素，时间复杂度为 O(k * n)。
+ * 批量插入把原数组与按索引排好序的插入项归并，一次遍历生成结果，时间复杂度为 O(n + k)，
+ * 相邻两个插入位置之间的元素用 memmove 整段移动。
+ *
+ * updates 按 index 非递减排列，index 取值 [0, size]，index 相同的按给出的顺序插入。
+ * 结果写入 res(至少能容纳 size + k 个元素)。res 可以与 arr 相同，此时从后向前原地归并，
+ * 要求 arr 的长度不小于 size + k。返回新数组的长度，插入项无序或越界时返回 -1 且不修改数组。
+ */
+int arrInsertBatch(int* arr, int size, const ArrUpdate* updates, int k, int* res)
+{
+    for (int j = 0; j < k; j++)
+    {
+        if (updates[j].index < 0 || updates[j].index > size ||
+            (j > 0 && updates[j].index < updates[j - 1].index))
+            return -1;
+    }
+
+    if (res == arr)
+    {
+        // 原地: 从后向前归并，每个元素只移动一次，且不会覆盖尚未移动的元素
+        int end = size; // [0, end) 为尚未移动的原数组元素
+        for (int j = k - 1; j >= 0; j--)
+        {
+            int index = updates[j].index;
+            memmove(arr + index + j + 1, arr + index, sizeof(int) * (size_t)(end - index));
+            arr[index + j] = updates[j].val;
+            end = index;
+        }
+    }
+    else
+    {
+        // 非原地: 从前向后顺序写入 res
+        int start = 0; // [start, size) 为尚未拷贝的原数组元素
+        int* out = res;
+        for (int j = 0; j < k; j++)
+        {
+            int index = updates[j].index;
+            memcpy(out, arr + start, sizeof(int) * (size_t)(index - start));
+            out += index - start;
+            *out++ = updates[j].val;
+            start = index;
+        }
+        memcpy(out, arr + start, sizeof(int) * (size_t)(size - start));
+    }
+
+    return size + k;
+}
+
+
+/**
+ * 批量删除
+ *
+ * 删除 indices 中的全部索引，时间复杂度为 O(n + k)。保留的元素按原顺序整段拷贝到 res 中。
+ * indices 按非递减排列，重复的索引只删除一次。res 可以与 arr 相同，此时原地从前向后压缩。
+ * 返回新数组的长度，索引无序或越界时返回 -1 且不修改数组。
+ */
+int arrDeleteBatch(int* arr, int size, const int* indices, int k, int* res)
+{
+    for (int j = 0; j < k; j++)
+    {
+        if (indices[j] < 0 || indices[j] >= size || (j > 0 && indices[j] < indices[j - 1]))
+            return -1;
+    }
+
+    int start = 0; // [start, size) 为尚未处理的原数组元素
+    int* out = res;
+    for (int j = 0; j < k; j++)
+    {
+        int index = indices[j];
+        if (index < start)
+            continue; // 重复的索引
+        // 原地时 out 不超过 arr + start，区间可能重叠，使用 memmove
+        memmove(out, arr + start, sizeof(int) * (size_t)(index - start));
+        out += index - start;
+        start = index + 1;
+    }
+    memmove(out, arr + start, sizeof(int) * (size_t)(size - start));
+    out += size - start;
+
+    return (int)(out - res);
+}
+
+
 /**
  * 遍历数组
  */
@@ -96,11 +184,12 @@ int arrFind(int* arr, int size, int target)
  * 扩容数组
  * 如果我们希望扩容数组，则需重新建立一个更大的数组，然后把原数组元素依次复制到新数组。
  * 在数组很大时，这种操作非常耗时。
+ * 新数组按缓存行对齐，较大时按大页对齐并请求透明大页(见 alignedAlloc.h)，仍然用 free 释放。
  */
 int* arrExtend(int* arr, int size, int enlarge)
 {
     // 初始化扩容后的数组
-    int* res = (int*)malloc(sizeof(int) * (size + enlarge));
+    int* res = (int*)alignedAlloc(sizeof(int) * (size_t)(size + enlarge));
     // 将原数组中的内容逐个复制到新数组中
     for (int i = 0; i < size; i++)
     {
@@ -130,73 +219,3 @@ void arrPrint(int* arr, int size)
     }
     printf("]\n");
 }
-
-int main()
-{
-    // 初始化随机数生成器
-    srand(time(0));
-
-    int arr[5] = {1, 3, 5, 7, 9};
-
-    /**
-     *随机索引访问数组示例
-     */
-    int val = randomAccess(arr, 5);
-    printf("Random value of array: %d\n\n", val);
-
-    /**
-     * 元素插入示例
-     * 这种情况下，数组的最后一个元素将被丢弃
-     */
-    int arr2[5] = {1, 3, 5, 7, 9};
-    printf("Before insert: %d\n", arr2[1]); // 3
-    int num = 2;
-    arrInsert(arr2, 5, num, 1);
-    printf("After insert: %d\n\n", arr2[1]); // 2
-
-    /**
-     * 元素删除示例
-     * 删除元素完成后，原先末尾的元素变得“无意义”了，所以我们无须特意去修改它。
-     */
-    int arr3[5] = {1, 3, 5, 7, 9};
-    printf("Before delete: %d\n", arr3[1]); // 3
-    arrDelete(arr3, 5, 1);
-    printf("After delete: %d\n\n", arr3[1]); // 5
-
-    /**
-     * 遍历数组示例
-     * 返回数组中元素和
-     */
-    int arr4[5] = {1, 3, 5, 7, 9};
-    int sum = traverse(arr4, 5);
-    printf("Sum: %d\n\n", sum);
-
-    /**
-     * 查找元素示例
-     * 返回查找到的元素在数组中的索引
-     */
-    int arr5[5] = {1, 3, 5, 7, 9};
-    int target = 7;
-    int indexOfTarget = arrFind(arr5, 5, target);
-    printf("Index of %d: %d\n\n", target, indexOfTarget);
-
-    /**
-     * 数组扩容示例
-     * 先扩容然后在数组中插入元素，观察与没有扩容时插入元素的区别
-     */
-    int arr6[5] = {1, 3, 5, 7, 9};
-    arrPrint(arr, 5); // 打印扩容前的数组
-
-    // 对数组扩容
-    int enlarge = 1;
-    int* arr6_extened = arrExtend(arr, 5, enlarge);
-
-    // 在数组中插入数值
-    arrInsert(arr6_extened, (5 + enlarge), 2, 1);
-    arrPrint(arr6_extened, 6); // 打印扩容后的数组
-
-    // 释放分配的内存
-    free(arr6_extened);
-
-    return 0;
-}
\ No newline at end of file
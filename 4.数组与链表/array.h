@@ -0,0 +1,22 @@
+#ifndef ARRAY_H
+#define ARRAY_H
+
+/* 批量插入的一项: 在原数组索引 index 的元素之前插入 val */
+typedef struct
+{
+    int index;
+    int val;
+} ArrUpdate;
+
+
+int randomAccess(int* arr, int size);
+void arrInsert(int* arr, int size, int num, int index);
+void arrDelete(int* arr, int size, int index);
+int traverse(int* arr, int size);
+int arrFind(int* arr, int size, int target);
+int* arrExtend(int* arr, int size, int enlarge);
+void arrPrint(int* arr, int size);
+int arrInsertBatch(int* arr, int size, const ArrUpdate* updates, int k, int* res);
+int arrDeleteBatch(int* arr, int size, const int* indices, int k, int* res);
+
+#endif
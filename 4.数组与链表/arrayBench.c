@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "array.h"
+
+/* 编译命令: gcc -O2 arrayBench.c array.c -o arrayBench */
+/* 运行: ./arrayBench [最大工作集 MB，默认 256] */
+
+/**
+ * 数组操作的内存延迟与带宽测试
+ *
+ * 工作集从 4KB 开始每次翻倍，依次落在 L1、L2、L3 缓存和主存中，对每种大小测量:
+ * 1. 依赖的随机访问(指针追逐): 下一次访问的位置由本次读到的值决定，测得的是内存延迟;
+ * 2. 独立的随机访问: 各次访问互不依赖，处理器可以同时发出多个请求;
+ * 3. traverse 顺序遍历、arrFind 查找不存在的元素: 顺序读带宽;
+ * 4. arrInsert / arrDelete 在头部插入、删除: 整个数组移动一位;
+ * 5. arrExtend 扩容: 分配新数组并拷贝。
+ * 随机访问报告 ns/op，其余报告 GB/s(按数组字节数计算，不区分读写)。
+ *
+ * randomAccess 每次调用都会打印且使用 rand() % size 生成索引，开销远大于访存本身，
+ * 因此随机访问使用 xorshift 生成索引，工作集取 2 的幂，用位与代替取余。
+ */
+
+/* 每种大小下随机访问的次数 */
+#define RANDOM_OPS (1 << 22)
+/* 每种大小下顺序操作至少处理的字节数 */
+#define STREAM_BYTES (1LL << 30)
+
+static volatile long long sink; // 防止计算结果被编译器优化掉
+
+
+/* 当前时间(秒) */
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static inline uint32_t xorshift(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+
+/* 用 Sattolo 算法把 arr 排列成一个覆盖全部 n 个位置的环: arr[i] 为下一个要访问的位置 */
+static void buildCycle(int* arr, int n)
+{
+    uint32_t state = 2463534242u;
+    for (int i = 0; i < n; i++)
+        arr[i] = i;
+    for (int i = n - 1; i > 0; i--)
+    {
+        int j = (int)(xorshift(&state) % (uint32_t)i); // j < i，保证只形成一个环
+        int temp = arr[i];
+        arr[i] = arr[j];
+        arr[j] = temp;
+    }
+}
+
+
+/* 依赖的随机访问，返回 ns/op */
+static double benchChase(int* arr, int n)
+{
+    buildCycle(arr, n);
+    int p = 0;
+    double start = now();
+    for (int i = 0; i < RANDOM_OPS; i++)
+        p = arr[p];
+    double t = now() - start;
+    sink += p;
+
+    return t * 1e9 / RANDOM_OPS;
+}
+
+
+/* 独立的随机访问，返回 ns/op */
+static double benchRandom(int* arr, int n)
+{
+    uint32_t state = 88172645u;
+    uint32_t mask = (uint32_t)n - 1;
+    long long sum = 0;
+    double start = now();
+    for (int i = 0; i < RANDOM_OPS; i++)
+        sum += arr[xorshift(&state) & mask];
+    double t = now() - start;
+    sink += sum;
+
+    return t * 1e9 / RANDOM_OPS;
+}
+
+
+/* 重复次数: 保证总字节数不少于 STREAM_BYTES */
+static int streamReps(int n, int scale)
+{
+    long long bytes = (long long)sizeof(int) * n;
+    long long reps = STREAM_BYTES / scale / bytes;
+
+    return reps > 0 ? (int)reps : 1;
+}
+
+
+/* 计算 GB/s */
+static double gbps(int n, int reps, double t)
+{
+    return (double)sizeof(int) * n * reps / t / 1e9;
+}
+
+
+static double benchTraverse(int* arr, int n)
+{
+    int reps = streamReps(n, 1);
+    double start = now();
+    for (int r = 0; r < reps; r++)
+        sink += traverse(arr, n);
+
+    return gbps(n, reps, now() - start);
+}
+
+
+static double benchFind(int* arr, int n)
+{
+    int reps = streamReps(n, 1);
+    double start = now();
+    for (int r = 0; r < reps; r++)
+        sink += arrFind(arr, n, -1); // 元素不存在，遍历整个数组
+
+    return gbps(n, reps, now() - start);
+}
+
+
+static double benchInsert(int* arr, int n)
+{
+    int reps = streamReps(n, 4); // 移动比顺序读慢，减少重复次数
+    double start = now();
+    for (int r = 0; r < reps; r++)
+        arrInsert(arr, n, r & 1, 0);
+    double t = now() - start;
+    sink += arr[n - 1];
+
+    return gbps(n, reps, t);
+}
+
+
+static double benchDelete(int* arr, int n)
+{
+    int reps = streamReps(n, 4);
+    double start = now();
+    for (int r = 0; r < reps; r++)
+        arrDelete(arr, n, 0);
+    double t = now() - start;
+    sink += arr[0];
+
+    return gbps(n, reps, t);
+}
+
+
+static double benchExtend(int* arr, int n)
+{
+    int reps = streamReps(n, 4);
+    double start = now();
+    for (int r = 0; r < reps; r++)
+    {
+        int* res = arrExtend(arr, n, 1);
+        sink += res[n];
+        free(res);
+    }
+
+    return gbps(n, reps, now() - start);
+}
+
+
+int main(int argc, char* argv[])
+{
+    long long maxBytes = (argc > 1 ? atoll(argv[1]) : 256) << 20;
+    int* arr = malloc((size_t)maxBytes);
+    if (arr == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+
+    printf("%10s %10s %10s %12s %12s %12s %12s %12s\n", "size", "chase", "random",
+           "traverse", "find", "insert", "delete", "extend");
+    printf("%10s %10s %10s %12s %12s %12s %12s %12s\n", "", "ns/op", "ns/op",
+           "GB/s", "GB/s", "GB/s", "GB/s", "GB/s");
+
+    for (long long bytes = 4096; bytes <= maxBytes; bytes *= 2)
+    {
+        int n = (int)(bytes / sizeof(int));
+        double chase = benchChase(arr, n);
+        double random = benchRandom(arr, n);
+        for (int i = 0; i < n; i++)
+            arr[i] = i & 1; // traverse 的和为 int，保持元素很小以免溢出
+        double trav = benchTraverse(arr, n);
+        double find = benchFind(arr, n);
+        double insert = benchInsert(arr, n);
+        double del = benchDelete(arr, n);
+        double extend = benchExtend(arr, n);
+
+        char label[32];
+        if (bytes < (1 << 20))
+            snprintf(label, sizeof(label), "%lldKB", bytes >> 10);
+        else
+            snprintf(label, sizeof(label), "%lldMB", bytes >> 20);
+        printf("%10s %10.2f %10.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n", label, chase, random,
+               trav, find, insert, del, extend);
+        fflush(stdout);
+    }
+
+    free(arr);
+
+    return 0;
+}
@@ -0,0 +1,410 @@
+#include <limits.h>
+#include "arraySimd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86 1
+#endif
+
+/**
+ * 数组的向量化查找与归约
+ *
+ * array.c 中的 arrFind 和 traverse 每次循环只处理一个元素。
+ * SIMD 指令一次处理多个元素: SSE4.1 一次 4 个 int, AVX2 一次 8 个 int。
+ *
+ * 每种操作提供三套实现: AVX2、SSE4.1 和标量版本。
+ * 程序启动时(main 之前)通过 __builtin_cpu_supports 检测 CPU 支持的指令集，选出最快的一套，
+ * 之后直接通过函数指针调用，多线程调用时无需同步。非 x86 平台只使用标量版本。
+ * 示例见 arraySimdTest.c。
+ *
+ * 支持的操作:
+ * 1. 查找: 返回第一个等于 target 的元素的索引
+ * 2. 计数: 统计等于 target 的元素个数
+ * 3. 求和: 使用 64 位累加器，避免 int 溢出
+ * 4. 最小值 / 最大值 / 最小值的索引
+ */
+
+/* 一组查找与归约函数 */
+typedef struct
+{
+    int (*find)(const int* arr, int size, int target);
+    int (*count)(const int* arr, int size, int target);
+    long long (*sum)(const int* arr, int size);
+    int (*min)(const int* arr, int size);
+    int (*max)(const int* arr, int size);
+} SimdKernels;
+
+
+/* ---------------- 标量版本 ---------------- */
+
+static int findScalar(const int* arr, int size, int target)
+{
+    for (int i = 0; i < size; i++)
+    {
+        if (arr[i] == target)
+            return i;
+    }
+
+    return -1;
+}
+
+static int countScalar(const int* arr, int size, int target)
+{
+    int count = 0;
+    for (int i = 0; i < size; i++)
+        count += (arr[i] == target);
+
+    return count;
+}
+
+static long long sumScalar(const int* arr, int size)
+{
+    long long sum = 0;
+    for (int i = 0; i < size; i++)
+        sum += arr[i];
+
+    return sum;
+}
+
+static int minScalar(const int* arr, int size)
+{
+    int res = INT_MAX;
+    for (int i = 0; i < size; i++)
+        res = arr[i] < res ? arr[i] : res;
+
+    return res;
+}
+
+static int maxScalar(const int* arr, int size)
+{
+    int res = INT_MIN;
+    for (int i = 0; i < size; i++)
+        res = arr[i] > res ? arr[i] : res;
+
+    return res;
+}
+
+
+#ifdef SIMD_X86
+
+/* ---------------- SSE4.1 版本: 每次处理 4 个元素 ---------------- */
+
+__attribute__((target("sse4.1")))
+static int findSse(const int* arr, int size, int target)
+{
+    __m128i t = _mm_set1_epi32(target);
+    int i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(arr + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, t)));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    int rest = findScalar(arr + i, size - i, target);
+
+    return rest < 0 ? -1 : i + rest;
+}
+
+__attribute__((target("sse4.1")))
+static int countSse(const int* arr, int size, int target)
+{
+    __m128i t = _mm_set1_epi32(target);
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(arr + i));
+        acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(v, t)); // 相等时比较结果为 -1
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + countScalar(arr + i, size - i, target);
+}
+
+__attribute__((target("sse4.1")))
+static long long sumSse(const int* arr, int size)
+{
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(arr + i));
+        // 先把 int 扩展为 64 位，再累加
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+    long long lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+
+    return lanes[0] + lanes[1] + sumScalar(arr + i, size - i);
+}
+
+__attribute__((target("sse4.1")))
+static int minSse(const int* arr, int size)
+{
+    __m128i acc = _mm_set1_epi32(INT_MAX);
+    int i = 0;
+    for (; i + 4 <= size; i += 4)
+        acc = _mm_min_epi32(acc, _mm_loadu_si128((const __m128i*)(arr + i)));
+    int lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+
+    int res = minScalar(arr + i, size - i);
+    for (int j = 0; j < 4; j++)
+        res = lanes[j] < res ? lanes[j] : res;
+
+    return res;
+}
+
+__attribute__((target("sse4.1")))
+static int maxSse(const int* arr, int size)
+{
+    __m128i acc = _mm_set1_epi32(INT_MIN);
+    int i = 0;
+    for (; i + 4 <= size; i += 4)
+        acc = _mm_max_epi32(acc, _mm_loadu_si128((const __m128i*)(arr + i)));
+    int lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+
+    int res = maxScalar(arr + i, size - i);
+    for (int j = 0; j < 4; j++)
+        res = lanes[j] > res ? lanes[j] : res;
+
+    return res;
+}
+
+
+/* ---------------- AVX2 版本: 每次处理 8 个元素 ---------------- */
+
+__attribute__((target("avx2")))
+static int findAvx2(const int* arr, int size, int target)
+{
+    __m256i t = _mm256_set1_epi32(target);
+    int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(arr + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, t)));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    int rest = findScalar(arr + i, size - i, target);
+
+    return rest < 0 ? -1 : i + rest;
+}
+
+__attribute__((target("avx2")))
+static int countAvx2(const int* arr, int size, int target)
+{
+    __m256i t = _mm256_set1_epi32(target);
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(arr + i));
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(v, t));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+
+    int count = countScalar(arr + i, size - i, target);
+    for (int j = 0; j < 8; j++)
+        count += lanes[j];
+
+    return count;
+}
+
+__attribute__((target("avx2")))
+static long long sumAvx2(const int* arr, int size)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(arr + i));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumScalar(arr + i, size - i);
+}
+
+__attribute__((target("avx2")))
+static int minAvx2(const int* arr, int size)
+{
+    __m256i acc = _mm256_set1_epi32(INT_MAX);
+    int i = 0;
+    for (; i + 8 <= size; i += 8)
+        acc = _mm256_min_epi32(acc, _mm256_loadu_si256((const __m256i*)(arr + i)));
+    int lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+
+    int res = minScalar(arr + i, size - i);
+    for (int j = 0; j < 8; j++)
+        res = lanes[j] < res ? lanes[j] : res;
+
+    return res;
+}
+
+__attribute__((target("avx2")))
+static int maxAvx2(const int* arr, int size)
+{
+    __m256i acc = _mm256_set1_epi32(INT_MIN);
+    int i = 0;
+    for (; i + 8 <= size; i += 8)
+        acc = _mm256_max_epi32(acc, _mm256_loadu_si256((const __m256i*)(arr + i)));
+    int lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+
+    int res = maxScalar(arr + i, size - i);
+    for (int j = 0; j < 8; j++)
+        res = lanes[j] > res ? lanes[j] : res;
+
+    return res;
+}
+
+#endif // SIMD_X86
+
+
+/* ---------------- 运行时分派 ---------------- */
+
+static const SimdKernels scalarKernels = {findScalar, countScalar, sumScalar, minScalar, maxScalar};
+#ifdef SIMD_X86
+static const SimdKernels sseKernels = {findSse, countSse, sumSse, minSse, maxSse};
+static const SimdKernels avx2Kernels = {findAvx2, countAvx2, sumAvx2, minAvx2, maxAvx2};
+#endif
+
+/* 当前使用的实现: 默认为标量版本，程序启动时替换为最快的一套，之后只读 */
+static const SimdKernels* kernels = &scalarKernels;
+
+/* 根据 CPU 支持的指令集选择实现，在 main 之前由运行时调用一次 */
+__attribute__((constructor))
+static void initKernels()
+{
+#ifdef SIMD_X86
+    __builtin_cpu_init(); // 构造函数可能早于 libgcc 的初始化执行，需要手动初始化
+    if (__builtin_cpu_supports("avx2"))
+        kernels = &avx2Kernels;
+    else if (__builtin_cpu_supports("sse4.1"))
+        kernels = &sseKernels;
+#endif
+}
+
+static inline const SimdKernels* getKernels()
+{
+    return kernels;
+}
+
+/* 获取当前使用的指令集名称 */
+const char* simdName()
+{
+    const SimdKernels* k = getKernels();
+#ifdef SIMD_X86
+    if (k == &avx2Kernels)
+        return "AVX2";
+    if (k == &sseKernels)
+        return "SSE4.1";
+#endif
+    return k == &scalarKernels ? "scalar" : "unknown";
+}
+
+
+/* ---------------- 数组接口 ---------------- */
+
+/* 查找元素，返回第一个匹配的索引，找不到返回 -1 */
+int arrFindSimd(const int* arr, int size, int target)
+{
+    return getKernels()->find(arr, size, target);
+}
+
+/* 统计等于 target 的元素个数 */
+int arrCountSimd(const int* arr, int size, int target)
+{
+    return getKernels()->count(arr, size, target);
+}
+
+/* 数组元素和(64 位) */
+long long arrSumSimd(const int* arr, int size)
+{
+    return getKernels()->sum(arr, size);
+}
+
+/* 最小值，空数组返回 INT_MAX */
+int arrMinSimd(const int* arr, int size)
+{
+    return getKernels()->min(arr, size);
+}
+
+/* 最大值，空数组返回 INT_MIN */
+int arrMaxSimd(const int* arr, int size)
+{
+    return getKernels()->max(arr, size);
+}
+
+/* 最小值的索引(有多个时返回第一个)，空数组返回 -1 */
+int arrArgminSimd(const int* arr, int size)
+{
+    if (size <= 0)
+        return -1;
+
+    // 先求最小值，再向量化查找它第一次出现的位置
+    return arrFindSimd(arr, size, arrMinSimd(arr, size));
+}
+
+
+/* ---------------- MyList 接口 ---------------- */
+
+/**
+ * 列表在间隙缓冲区模式下由间隙分成前后两段，分别在两段上运行内核即可，无需先压缩。
+ * gapLen 为 0 时后一段为空。
+ */
+#define HEAD_LEN(list) ((list)->gapLen > 0 ? (list)->gapStart : (list)->size)
+#define TAIL_PTR(list) ((list)->arr + HEAD_LEN(list) + (list)->gapLen)
+#define TAIL_LEN(list) ((list)->size - HEAD_LEN(list))
+
+int listFind(MyList* list, int target)
+{
+    int index = arrFindSimd(list->arr, HEAD_LEN(list), target);
+    if (index >= 0)
+        return index;
+
+    index = arrFindSimd(TAIL_PTR(list), TAIL_LEN(list), target);
+    return index < 0 ? -1 : HEAD_LEN(list) + index;
+}
+
+int listCount(MyList* list, int target)
+{
+    return arrCountSimd(list->arr, HEAD_LEN(list), target) +
+           arrCountSimd(TAIL_PTR(list), TAIL_LEN(list), target);
+}
+
+long long listSum(MyList* list)
+{
+    return arrSumSimd(list->arr, HEAD_LEN(list)) + arrSumSimd(TAIL_PTR(list), TAIL_LEN(list));
+}
+
+int listMin(MyList* list)
+{
+    int a = arrMinSimd(list->arr, HEAD_LEN(list));
+    int b = arrMinSimd(TAIL_PTR(list), TAIL_LEN(list));
+    return a < b ? a : b;
+}
+
+int listMax(MyList* list)
+{
+    int a = arrMaxSimd(list->arr, HEAD_LEN(list));
+    int b = arrMaxSimd(TAIL_PTR(list), TAIL_LEN(list));
+    return a > b ? a : b;
+}
+
+int listArgmin(MyList* list)
+{
+    if (list->size <= 0)
+        return -1;
+
+    return listFind(list, listMin(list));
+}
@@ -0,0 +1,27 @@
+#ifndef ARRAY_SIMD_H
+#define ARRAY_SIMD_H
+
+#include "list.h"
+
+/**
+ * 数组与列表的向量化查找与归约
+ *
+ * 运行时按 CPU 支持的指令集(AVX2 / SSE4.1 / 标量)选择实现，见 arraySimd.c。
+ * 列表接口直接在间隙缓冲区的前后两段上运行，不需要先合并间隙。
+ */
+
+const char* simdName();
+int arrFindSimd(const int* arr, int size, int target);
+int arrCountSimd(const int* arr, int size, int target);
+long long arrSumSimd(const int* arr, int size);
+int arrMinSimd(const int* arr, int size);
+int arrMaxSimd(const int* arr, int size);
+int arrArgminSimd(const int* arr, int size);
+int listFind(MyList* list, int target);
+int listCount(MyList* list, int target);
+long long listSum(MyList* list);
+int listMin(MyList* list);
+int listMax(MyList* list);
+int listArgmin(MyList* list);
+
+#endif
@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+#include "arraySimd.h"
+
+/* 编译命令: gcc -O2 arraySimdTest.c arraySimd.c -o arraySimdTest */
+
+
+/* 标量版本，用于对比结果和耗时 */
+static long long sumScalar(const int* arr, int size)
+{
+    long long sum = 0;
+    for (int i = 0; i < size; i++)
+        sum += arr[i];
+
+    return sum;
+}
+
+static int findScalar(const int* arr, int size, int target)
+{
+    for (int i = 0; i < size; i++)
+    {
+        if (arr[i] == target)
+            return i;
+    }
+
+    return -1;
+}
+
+
+int main(void)
+{
+    printf("Kernels: %s\n\n", simdName());
+
+    /**
+     * 小数组示例
+     */
+    int arr[11] = {5, 3, 9, -2, 7, 3, 8, 1, -2, 4, 6};
+    printf("Find 7: %d\n", arrFindSimd(arr, 11, 7));       // 4
+    printf("Count 3: %d\n", arrCountSimd(arr, 11, 3));     // 2
+    printf("Sum: %lld\n", arrSumSimd(arr, 11));            // 42
+    printf("Min: %d, Max: %d\n", arrMinSimd(arr, 11), arrMaxSimd(arr, 11)); // -2, 9
+    printf("Argmin: %d\n\n", arrArgminSimd(arr, 11));      // 3
+
+    /**
+     * 大数组: 与标量版本对比结果和耗时
+     * 元素值接近 INT_MAX, 用 int 累加会溢出
+     */
+    int n = 1 << 24;
+    int* big = malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++)
+        big[i] = INT_MAX - (i % 1000);
+    big[n - 3] = -1;
+
+    clock_t start = clock();
+    long long scalarSum = sumScalar(big, n);
+    int scalarFind = findScalar(big, n, -1);
+    double scalarTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    long long simdSum = arrSumSimd(big, n);
+    int simdFind = arrFindSimd(big, n, -1);
+    double simdTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("Scalar: sum = %lld, find = %d, %.4fs\n", scalarSum, scalarFind, scalarTime);
+    printf("SIMD:   sum = %lld, find = %d, %.4fs\n\n", simdSum, simdFind, simdTime);
+    free(big);
+
+    /**
+     * MyList 示例(只用到结构体字段，无需链接 list.c)
+     */
+    MyList list = {.arr = arr, .capacity = 11, .size = 11};
+    printf("List argmin: %d, sum: %lld\n", listArgmin(&list), listSum(&list)); // 3, 42
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "array.h"
+
+/* 编译命令: gcc arrayTest.c array.c -o arrayTest */
+
+
+int main()
+{
+    // 初始化随机数生成器
+    srand(time(0));
+
+    int arr[5] = {1, 3, 5, 7, 9};
+
+    /**
+     *随机索引访问数组示例
+     */
+    int val = randomAccess(arr, 5);
+    printf("Random value of array: %d\n\n", val);
+
+    /**
+     * 元素插入示例
+     * 这种情况下，数组的最后一个元素将被丢弃
+     */
+    int arr2[5] = {1, 3, 5, 7, 9};
+    printf("Before insert: %d\n", arr2[1]); // 3
+    int num = 2;
+    arrInsert(arr2, 5, num, 1);
+    printf("After insert: %d\n\n", arr2[1]); // 2
+
+    /**
+     * 元素删除示例
+     * 删除元素完成后，原先末尾的元素变得“无意义”了，所以我们无须特意去修改它。
+     */
+    int arr3[5] = {1, 3, 5, 7, 9};
+    printf("Before delete: %d\n", arr3[1]); // 3
+    arrDelete(arr3, 5, 1);
+    printf("After delete: %d\n\n", arr3[1]); // 5
+
+    /**
+     * 批量插入与删除示例
+     * 一次遍历完成全部修改，数组长度需要预留出插入的元素
+     */
+    int arr7[8] = {1, 3, 5, 7, 9};
+    ArrUpdate updates[3] = {{0, 0}, {2, 4}, {5, 10}};
+    int newSize = arrInsertBatch(arr7, 5, updates, 3, arr7); // 原地插入
+    arrPrint(arr7, newSize); // [0, 1, 3, 4, 5, 7, 9, 10]
+    int indices[3] = {0, 3, 7};
+    newSize = arrDeleteBatch(arr7, newSize, indices, 3, arr7); // 原地删除
+    arrPrint(arr7, newSize); // [1, 3, 5, 7, 9]
+    printf("\n");
+
+    /**
+     * 遍历数组示例
+     * 返回数组中元素和
+     */
+    int arr4[5] = {1, 3, 5, 7, 9};
+    int sum = traverse(arr4, 5);
+    printf("Sum: %d\n\n", sum);
+
+    /**
+     * 查找元素示例
+     * 返回查找到的元素在数组中的索引
+     */
+    int arr5[5] = {1, 3, 5, 7, 9};
+    int target = 7;
+    int indexOfTarget = arrFind(arr5, 5, target);
+    printf("Index of %d: %d\n\n", target, indexOfTarget);
+
+    /**
+     * 数组扩容示例
+     * 先扩容然后在数组中插入元素，观察与没有扩容时插入元素的区别
+     */
+    int arr6[5] = {1, 3, 5, 7, 9};
+    arrPrint(arr, 5); // 打印扩容前的数组
+
+    // 对数组扩容
+    int enlarge = 1;
+    int* arr6_extened = arrExtend(arr, 5, enlarge);
+
+    // 在数组中插入数值
+    arrInsert(arr6_extened, (5 + enlarge), 2, 1);
+    arrPrint(arr6_extened, 6); // 打印扩容后的数组
+
+    // 释放分配的内存
+    free(arr6_extened);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,288 @@
+#define _GNU_SOURCE // mremap
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "bigList.h"
+
+/* 编译命令: gcc -O2 bigList.c -o bigList */
+
+/**
+ * 64 位索引的数组与列表
+ *
+ * array.c 和 MyList 中的大小、容量、索引都是 int:
+ * 1. 元素数量超过 2^31 - 1 时 size 溢出;
+ * 2. 扩容时 capacity * extendRadio 在容量达到 2^30 时就会溢出;
+ * 3. sizeof(int) * size 在 int 上计算，超过 2GB 就会出错。
+ * 这里的版本统一使用 size_t，扩容前检查乘法溢出，容量上限为 BIG_MAX_CAPACITY。
+ * 大数组与 MyList 一样改用 mmap / mremap 扩容，避免拷贝数百 GB 的数据。
+ */
+
+
+/* ---------------- 数组 ---------------- */
+
+/* 在数组的索引 index 处插入元素 num (超出长度的末尾元素丢失) */
+void arrInsertBig(int* arr, size_t size, int num, size_t index)
+{
+    if (index >= size)
+        return;
+
+    // 把 index 后的元素全部向后移一位
+    memmove(arr + index + 1, arr + index, sizeof(int) * (size - index - 1));
+    arr[index] = num;
+}
+
+/* 删除索引 index 处的元素 */
+void arrDeleteBig(int* arr, size_t size, size_t index)
+{
+    if (index >= size)
+        return;
+
+    // 把索引 index 之后的所有元素向前移动一位
+    memmove(arr + index, arr + index + 1, sizeof(int) * (size - index - 1));
+}
+
+/* 遍历数组，返回元素和(64 位) */
+long long traverseBig(int* arr, size_t size)
+{
+    long long sum = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        sum += arr[i];
+    }
+
+    return sum;
+}
+
+/* 在数组中查找元素，返回索引，找不到返回 -1 */
+int64_t arrFindBig(int* arr, size_t size, int target)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        if (arr[i] == target)
+            return (int64_t)i;
+    }
+
+    return -1;
+}
+
+/* 扩容数组，扩容后的长度溢出或分配失败时返回 NULL */
+int* arrExtendBig(int* arr, size_t size, size_t enlarge)
+{
+    if (enlarge > BIG_MAX_CAPACITY - size)
+        return NULL;
+
+    int* res = (int*)malloc(sizeof(int) * (size + enlarge));
+    if (res == NULL)
+        return NULL;
+    memcpy(res, arr, sizeof(int) * size);
+    memset(res + size, 0, sizeof(int) * enlarge); // 初始化扩容后的空间
+
+    return res;
+}
+
+
+/* ---------------- 列表 ---------------- */
+
+/**
+ * 计算扩容后的容量
+ *
+ * capacity * extendRadio 超过 BIG_MAX_CAPACITY 时返回 BIG_MAX_CAPACITY;
+ * 容量已经达到上限时返回 0，表示无法继续扩容。
+ */
+size_t nextCapacityBig(size_t capacity, size_t extendRadio)
+{
+    if (capacity >= BIG_MAX_CAPACITY)
+        return 0;
+    if (capacity > BIG_MAX_CAPACITY / extendRadio)
+        return BIG_MAX_CAPACITY;
+
+    return capacity * extendRadio;
+}
+
+/* 将字节数向上对齐到页大小 */
+static size_t pageAlign(size_t bytes)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return (bytes + page - 1) / page * page;
+}
+
+/* 构造函数 */
+BigList* newBigList()
+{
+    BigList* list = (BigList*)malloc(sizeof(BigList));
+    list->capacity = 10; // 列表容量默认初始化为10
+    list->arr = malloc(sizeof(int) * list->capacity);
+    list->size = 0;
+    list->extendRadio = 2;
+    list->mapped = 0;
+    list->mapBytes = 0;
+
+    return list;
+}
+
+/* 析构函数 */
+void destroyBigList(BigList* list)
+{
+    if (list != NULL)
+    {
+        if (list->mapped)
+            munmap(list->arr, list->mapBytes);
+        else
+            free(list->arr);
+        free(list);
+    }
+}
+
+/* 获取列表长度 */
+size_t sizeBigList(BigList* list)
+{
+    return list->size;
+}
+
+/* 获取列表容量 */
+size_t capacityBigList(BigList* list)
+{
+    return list->capacity;
+}
+
+/* 扩容列表 */
+void extendCapacityBigList(BigList* list)
+{
+    size_t newCapacity = nextCapacityBig(list->capacity, list->extendRadio);
+    if (newCapacity == 0) {
+        fprintf(stderr, "BigList capacity overflow!\n");
+        exit(1);
+    }
+    size_t newBytes = sizeof(int) * newCapacity; // 不会溢出: newCapacity <= BIG_MAX_CAPACITY
+
+    void* extend;
+    if (list->mapped)
+    {
+        size_t mapBytes = pageAlign(newBytes);
+        extend = mremap(list->arr, list->mapBytes, mapBytes, MREMAP_MAYMOVE);
+        if (extend != MAP_FAILED)
+            list->mapBytes = mapBytes;
+    }
+    else if (newBytes >= BIG_MMAP_THRESHOLD)
+    {
+        // 从堆迁移到匿名映射，之后的扩容由内核重新映射页表，不再拷贝
+        size_t mapBytes = pageAlign(newBytes);
+        extend = mmap(NULL, mapBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (extend != MAP_FAILED)
+        {
+            memcpy(extend, list->arr, sizeof(int) * list->size);
+            free(list->arr);
+            list->mapped = 1;
+            list->mapBytes = mapBytes;
+        }
+    }
+    else
+    {
+        extend = realloc(list->arr, newBytes);
+        if (extend == NULL)
+            extend = MAP_FAILED;
+    }
+
+    if (extend == MAP_FAILED) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);  // 内存分配失败时，终止程序
+    }
+    list->arr = extend;
+    list->capacity = newCapacity;
+}
+
+/* 访问元素 */
+int getBigList(BigList* list, size_t index)
+{
+    if (index < list->size)
+        return list->arr[index];
+
+    return -1;
+}
+
+/* 更新元素 */
+int setBigList(BigList* list, size_t index, int val)
+{
+    if (index < list->size)
+    {
+        list->arr[index] = val;
+        return 0;
+    }
+
+    return -1;
+}
+
+/* 在列表尾部追加元素 */
+void pushBigList(BigList* list, int val)
+{
+    if (list->size == list->capacity)
+        extendCapacityBigList(list);
+
+    list->arr[list->size++] = val;
+}
+
+/* 在列表中插入元素 */
+void insertBigList(BigList* list, size_t index, int val)
+{
+    if (index > list->size)
+        exit(1);
+
+    if (list->size == list->capacity)
+        extendCapacityBigList(list);
+
+    memmove(list->arr + index + 1, list->arr + index, sizeof(int) * (list->size - index));
+    list->arr[index] = val;
+    list->size++;
+}
+
+/* 删除元素 */
+int delBigList(BigList* list, size_t index)
+{
+    if (index >= list->size)
+        return -1;
+
+    int num = list->arr[index];
+    memmove(list->arr + index, list->arr + index + 1, sizeof(int) * (list->size - index - 1));
+    list->size--;
+
+    return num;
+}
+
+/* 将列表转换为 Array */
+int* toArrayBigList(BigList* list)
+{
+    return list->arr;
+}
+
+
+int main(void)
+{
+    /**
+     * 溢出检查示例
+     * int 版本的 capacity * 2 在容量达到 2^30 时溢出，这里按 size_t 计算并截断到上限
+     */
+    size_t cap = (size_t)1 << 31;
+    printf("Next capacity of 2^31: %zu\n", nextCapacityBig(cap, 2));              // 4294967296
+    printf("Next capacity near limit: %zu\n", nextCapacityBig(BIG_MAX_CAPACITY - 1, 2)); // BIG_MAX_CAPACITY
+    printf("Next capacity at limit: %zu\n\n", nextCapacityBig(BIG_MAX_CAPACITY, 2)); // 0
+
+    /**
+     * 列表测试
+     */
+    BigList* list = newBigList();
+    for (int i = 0; i < 32 * 1024 * 1024; i++)
+    {
+        pushBigList(list, i);
+    }
+    insertBigList(list, 1, -1);
+    delBigList(list, 0);
+    printf("Size: %zu, capacity: %zu, mapped: %d\n", sizeBigList(list), capacityBigList(list), list->mapped);
+    printf("Element 0: %d, sum: %lld\n", getBigList(list, 0), traverseBig(toArrayBigList(list), sizeBigList(list)));
+    printf("Index of 1000: %lld\n", (long long)arrFindBig(toArrayBigList(list), sizeBigList(list), 1000)); // 1000
+
+    destroyBigList(list);
+
+    return 0;
+}
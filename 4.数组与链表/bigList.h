@@ -0,0 +1,50 @@
+#ifndef BIG_LIST_H
+#define BIG_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * 64 位索引的列表
+ *
+ * 与 MyList 相同，但大小、容量和索引都使用 size_t，可以容纳超过 2^31 个元素。
+ * 包含: 数组, 列表容量，列表大小，列表每次扩容的倍数
+ */
+typedef struct
+{
+    int* arr;           // 数组，存储列表元素
+    size_t capacity;    // 列表的最大容量
+    size_t size;        // 列表中的元素数量
+    size_t extendRadio; // 每次扩容的倍数
+    int mapped;         // 内部数组是否由 mmap 分配
+    size_t mapBytes;    // mmap 分配时映射区的字节数
+} BigList;
+
+/* 元素个数的上限: 字节数不能超过 PTRDIFF_MAX */
+#define BIG_MAX_CAPACITY ((size_t)PTRDIFF_MAX / sizeof(int))
+/* 内部数组超过该字节数后改用 mmap 存储 */
+#define BIG_MMAP_THRESHOLD ((size_t)64 * 1024 * 1024)
+
+
+/* 64 位索引的数组操作 */
+void arrInsertBig(int* arr, size_t size, int num, size_t index);
+void arrDeleteBig(int* arr, size_t size, size_t index);
+long long traverseBig(int* arr, size_t size);
+int64_t arrFindBig(int* arr, size_t size, int target);
+int* arrExtendBig(int* arr, size_t size, size_t enlarge);
+
+/* 64 位索引的列表操作 */
+size_t nextCapacityBig(size_t capacity, size_t extendRadio);
+BigList* newBigList();
+void destroyBigList(BigList* list);
+size_t sizeBigList(BigList* list);
+size_t capacityBigList(BigList* list);
+void extendCapacityBigList(BigList* list);
+int getBigList(BigList* list, size_t index);
+int setBigList(BigList* list, size_t index, int val);
+void pushBigList(BigList* list, int val);
+void insertBigList(BigList* list, size_t index, int val);
+int delBigList(BigList* list, size_t index);
+int* toArrayBigList(BigList* list);
+
+#endif
@@ -0,0 +1,375 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "compressedList.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* 编译命令: gcc -O2 compressedList.c list.c -o compressedList */
+
+/**
+ * 压缩整数列表(差分 + 位打包)
+ *
+ * 有序或接近有序的 ID 列表中，相邻元素的差值通常很小，用 4 字节存放每个元素很浪费。
+ * 1. 分块: 每 CBLOCK_SIZE(128) 个元素一块，块头记录第一个元素和解码所需的参数，
+ *    因此访问任意元素只需解码它所在的一块，时间复杂度 O(CBLOCK_SIZE)。
+ * 2. 差分: 存放相邻元素的差值 d[i]。
+ * 3. FOR(frame of reference): 减去块内最小差值，得到非负整数 u[i]。
+ * 4. 位打包: 所有 u[i] 只用 b 位存放。
+ * 5. PFOR(patched FOR): b 按总字节数最小来选择，少数放不下的 u[i] 作为异常值单独存放，
+ *    避免一个大跳跃让整块都使用很大的位宽。
+ *
+ * 位打包采用 4 路交错布局: 第 i 个元素属于第 i % 4 路，各路依次打包，4 路的第 k 个字交错存放。
+ * 这样一条 SSE2 指令就能同时解出 4 个相邻元素，再用寄存器内的前缀和还原出原始值。
+ */
+
+/* x 的有效位数 */
+static inline int bitsOf(uint32_t x)
+{
+    return x == 0 ? 0 : 32 - __builtin_clz(x);
+}
+
+/* b 位的掩码 */
+static inline uint32_t maskOf(int b)
+{
+    return b == 32 ? 0xFFFFFFFFu : (1u << b) - 1;
+}
+
+/* 把 128 个值的低 b 位打包到 words(4 * b 个字) */
+static void packBlock(const uint32_t* u, int b, uint32_t* words)
+{
+    memset(words, 0, sizeof(uint32_t) * 4 * (size_t)b);
+    uint32_t mask = maskOf(b);
+    for (int i = 0; i < CBLOCK_SIZE; i++)
+    {
+        int lane = i & 3;
+        int off = (i >> 2) * b;   // 在本路中的位偏移
+        int w = off >> 5, sh = off & 31;
+        uint32_t val = u[i] & mask;
+        words[w * 4 + lane] |= val << sh;
+        if (sh + b > 32)
+            words[(w + 1) * 4 + lane] |= val >> (32 - sh);
+    }
+}
+
+/* 解包 128 个 b 位的值 */
+static void unpackBlock(const uint32_t* words, int b, uint32_t* u)
+{
+    if (b == 0)
+    {
+        memset(u, 0, sizeof(uint32_t) * CBLOCK_SIZE);
+        return;
+    }
+
+#ifdef __SSE2__
+    __m128i mask = _mm_set1_epi32((int)maskOf(b));
+    for (int j = 0; j < CBLOCK_SIZE / 4; j++)
+    {
+        int off = j * b;
+        int w = off >> 5, sh = off & 31;
+        __m128i lo = _mm_loadu_si128((const __m128i*)(words + w * 4));
+        __m128i v = _mm_srl_epi32(lo, _mm_cvtsi32_si128(sh));
+        if (sh + b > 32)
+        {
+            __m128i hi = _mm_loadu_si128((const __m128i*)(words + (w + 1) * 4));
+            v = _mm_or_si128(v, _mm_sll_epi32(hi, _mm_cvtsi32_si128(32 - sh)));
+        }
+        _mm_storeu_si128((__m128i*)(u + j * 4), _mm_and_si128(v, mask));
+    }
+#else
+    uint32_t mask = maskOf(b);
+    for (int i = 0; i < CBLOCK_SIZE; i++)
+    {
+        int lane = i & 3;
+        int off = (i >> 2) * b;
+        int w = off >> 5, sh = off & 31;
+        uint32_t val = words[w * 4 + lane] >> sh;
+        if (sh + b > 32)
+            val |= words[(w + 1) * 4 + lane] << (32 - sh);
+        u[i] = val & mask;
+    }
+#endif
+}
+
+/* 根据 u[i] 的位数直方图选择总字节数最少的位宽 */
+static int chooseBitWidth(const uint32_t* u, int* excCount)
+{
+    int hist[33] = {0};
+    for (int i = 0; i < CBLOCK_SIZE; i++)
+        hist[bitsOf(u[i])]++;
+
+    int best = 32, bestCost = 16 * 32, exc = 0;
+    *excCount = 0;
+    // 从大到小尝试，exc 为位数超过 b 的元素个数
+    for (int b = 32; b >= 0; b--)
+    {
+        int cost = 16 * b + 5 * exc; // 打包数据 + 异常值(1 字节位置 + 4 字节值)
+        if (cost <= bestCost)
+        {
+            best = b;
+            bestCost = cost;
+            *excCount = exc;
+        }
+        exc += hist[b];
+    }
+
+    return best;
+}
+
+
+/* 由列表构建压缩列表 */
+CompressedList* newCompressedList(MyList* list)
+{
+    const int* arr = readArray(list);
+    int n = size(list);
+
+    CompressedList* cl = malloc(sizeof(CompressedList));
+    cl->size = n;
+    cl->numBlocks = (n + CBLOCK_SIZE - 1) / CBLOCK_SIZE;
+    cl->headers = malloc(sizeof(BlockHeader) * (size_t)(cl->numBlocks > 0 ? cl->numBlocks : 1));
+    // 按最坏情况分配，构建完成后缩小
+    cl->words = malloc(sizeof(uint32_t) * (size_t)CBLOCK_SIZE * (cl->numBlocks > 0 ? cl->numBlocks : 1));
+    cl->excPos = malloc(n > 0 ? (size_t)n : 1);
+    cl->excVal = malloc(sizeof(uint32_t) * (size_t)(n > 0 ? n : 1));
+    if (cl->headers == NULL || cl->words == NULL || cl->excPos == NULL || cl->excVal == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+
+    uint32_t wordOffset = 0, excOffset = 0;
+    uint32_t u[CBLOCK_SIZE];
+    for (int blk = 0; blk < cl->numBlocks; blk++)
+    {
+        const int* v = arr + blk * CBLOCK_SIZE;
+        int len = n - blk * CBLOCK_SIZE < CBLOCK_SIZE ? n - blk * CBLOCK_SIZE : CBLOCK_SIZE;
+
+        // 差分(按 32 位回绕计算)，求最小差值
+        int minDelta = 0;
+        for (int i = 1; i < len; i++)
+        {
+            int d = (int)((uint32_t)v[i] - (uint32_t)v[i - 1]);
+            if (i == 1 || d < minDelta)
+                minDelta = d;
+        }
+        u[0] = 0;
+        for (int i = 1; i < CBLOCK_SIZE; i++)
+            u[i] = i < len ? (uint32_t)v[i] - (uint32_t)v[i - 1] - (uint32_t)minDelta : 0;
+
+        int excCount;
+        int b = chooseBitWidth(u, &excCount);
+
+        BlockHeader* h = &cl->headers[blk];
+        h->first = v[0];
+        h->minDelta = minDelta;
+        h->wordOffset = wordOffset;
+        h->excOffset = excOffset;
+        h->bitWidth = (uint8_t)b;
+        h->excCount = (uint8_t)excCount;
+
+        // 记录异常值
+        for (int i = 0; i < CBLOCK_SIZE; i++)
+        {
+            if (bitsOf(u[i]) > b)
+            {
+                cl->excPos[excOffset] = (uint8_t)i;
+                cl->excVal[excOffset] = u[i];
+                excOffset++;
+            }
+        }
+        packBlock(u, b, cl->words + wordOffset);
+        wordOffset += 4 * b;
+    }
+
+    cl->words = realloc(cl->words, sizeof(uint32_t) * (wordOffset > 0 ? wordOffset : 1));
+    cl->excPos = realloc(cl->excPos, excOffset > 0 ? excOffset : 1);
+    cl->excVal = realloc(cl->excVal, sizeof(uint32_t) * (excOffset > 0 ? excOffset : 1));
+
+    return cl;
+}
+
+/* 析构函数 */
+void destroyCompressedList(CompressedList* list)
+{
+    if (list != NULL)
+    {
+        free(list->headers);
+        free(list->words);
+        free(list->excPos);
+        free(list->excVal);
+        free(list);
+    }
+}
+
+/* 获取列表长度 */
+int sizeCompressedList(CompressedList* list)
+{
+    return list->size;
+}
+
+/* 压缩后占用的字节数 */
+size_t bytesCompressedList(CompressedList* list)
+{
+    size_t exc = 0;
+    size_t words = 0;
+    for (int blk = 0; blk < list->numBlocks; blk++)
+    {
+        exc += list->headers[blk].excCount;
+        words += 4 * (size_t)list->headers[blk].bitWidth;
+    }
+
+    return sizeof(CompressedList) + sizeof(BlockHeader) * (size_t)list->numBlocks +
+           sizeof(uint32_t) * words + 5 * exc;
+}
+
+/* 解码第 blk 块的 CBLOCK_SIZE 个元素到 out */
+void decodeBlock(CompressedList* list, int blk, int* out)
+{
+    BlockHeader* h = &list->headers[blk];
+    uint32_t* u = (uint32_t*)out;
+
+    unpackBlock(list->words + h->wordOffset, h->bitWidth, u);
+    // 修补异常值
+    for (int e = 0; e < h->excCount; e++)
+        u[list->excPos[h->excOffset + e]] = list->excVal[h->excOffset + e];
+
+    // 前缀和还原: v[i] = v[i - 1] + u[i] + minDelta，其中 u[0] = 0, v[0] = first
+#ifdef __SSE2__
+    __m128i delta = _mm_set1_epi32(h->minDelta);
+    __m128i carry = _mm_set1_epi32((int)((uint32_t)h->first - (uint32_t)h->minDelta));
+    for (int i = 0; i < CBLOCK_SIZE; i += 4)
+    {
+        __m128i x = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(u + i)), delta);
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4)); // 寄存器内前缀和
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        _mm_storeu_si128((__m128i*)(out + i), x);
+        carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3)); // 广播最后一个元素
+    }
+#else
+    uint32_t prev = (uint32_t)h->first - (uint32_t)h->minDelta;
+    for (int i = 0; i < CBLOCK_SIZE; i++)
+    {
+        prev += u[i] + (uint32_t)h->minDelta;
+        out[i] = (int)prev;
+    }
+#endif
+}
+
+/* 访问元素: 只解码元素所在的块 */
+int getCompressedList(CompressedList* list, int index)
+{
+    if (index < 0 || index >= list->size)
+        return -1;
+
+    int buf[CBLOCK_SIZE];
+    decodeBlock(list, index / CBLOCK_SIZE, buf);
+
+    return buf[index % CBLOCK_SIZE];
+}
+
+/* 解压全部元素到数组 res 中(res 至少能容纳 size 个元素) */
+int* toArrayCompressedList(CompressedList* list, int* res)
+{
+    int buf[CBLOCK_SIZE];
+    for (int blk = 0; blk < list->numBlocks; blk++)
+    {
+        int start = blk * CBLOCK_SIZE;
+        int len = list->size - start < CBLOCK_SIZE ? list->size - start : CBLOCK_SIZE;
+        if (len == CBLOCK_SIZE)
+        {
+            decodeBlock(list, blk, res + start);
+        }
+        else
+        {
+            decodeBlock(list, blk, buf);
+            memcpy(res + start, buf, sizeof(int) * (size_t)len);
+        }
+    }
+
+    return res;
+}
+
+/* 初始化迭代器 */
+void initCompressedIter(CompressedIter* it, CompressedList* list)
+{
+    it->list = list;
+    it->index = 0;
+}
+
+/* 取出下一个元素，遍历结束时返回 0 */
+int nextCompressedIter(CompressedIter* it, int* val)
+{
+    if (it->index >= it->list->size)
+        return 0;
+
+    int offset = it->index % CBLOCK_SIZE;
+    if (offset == 0)
+        decodeBlock(it->list, it->index / CBLOCK_SIZE, it->buf);
+    *val = it->buf[offset];
+    it->index++;
+
+    return 1;
+}
+
+
+int main(void)
+{
+    /**
+     * 接近有序的 ID 列表: 大部分差值很小，偶尔有大跳跃和逆序
+     */
+    int n = 10000000;
+    MyList* list = newMyList();
+    srand(1);
+    int id = -1000;
+    for (int i = 0; i < n; i++)
+    {
+        id += rand() % 16;
+        if (i % 1000 == 0)
+            id += 1 << 16;   // 大跳跃，作为异常值存放
+        pushElement(list, i % 97 == 0 ? id - 5 : id); // 偶尔逆序
+    }
+
+    CompressedList* cl = newCompressedList(list);
+    size_t raw = sizeof(int) * (size_t)n;
+    size_t packed = bytesCompressedList(cl);
+    printf("Raw: %zu bytes, compressed: %zu bytes, ratio: %.2fx\n", raw, packed, (double)raw / packed);
+
+    // 随机访问
+    int ok = 1;
+    for (int i = 0; i < 100000; i++)
+    {
+        int index = rand() % n;
+        ok &= getCompressedList(cl, index) == getElement(list, index);
+    }
+    printf("Random access correct: %d\n", ok); // 1
+
+    // 顺序遍历: 与原始数组对比求和
+    clock_t start = clock();
+    long long sum = 0;
+    CompressedIter it;
+    initCompressedIter(&it, cl);
+    int val;
+    while (nextCompressedIter(&it, &val))
+        sum += val;
+    double iterTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    long long rawSum = 0;
+    const int* arr = readArray(list);
+    for (int i = 0; i < n; i++)
+        rawSum += arr[i];
+    printf("Sequential sum correct: %d, %.3fs\n", sum == rawSum, iterTime); // 1
+
+    // 全部解压
+    int* res = malloc(sizeof(int) * n);
+    toArrayCompressedList(cl, res);
+    printf("Full decode correct: %d\n", memcmp(res, arr, sizeof(int) * n) == 0); // 1
+    free(res);
+
+    destroyCompressedList(cl);
+    destoryMyList(list);
+
+    return 0;
+}
@@ -0,0 +1,60 @@
+#ifndef COMPRESSED_LIST_H
+#define COMPRESSED_LIST_H
+
+#include <stdint.h>
+#include "list.h"
+
+/* 每块的元素个数 */
+#define CBLOCK_SIZE 128
+
+/**
+ * 块头
+ *
+ * 块内第 i 个元素 = 第 i - 1 个元素 + (minDelta + u[i])，u[i] 为位打包的无符号整数。
+ * 位宽放不下的少数 u[i] 作为异常值单独存放(PFOR)。
+ */
+typedef struct
+{
+    int first;           // 块中第一个元素
+    int minDelta;        // 块内相邻元素差值的最小值(FOR 参照值)
+    uint32_t wordOffset; // 位打包数据在 words 中的起始位置
+    uint32_t excOffset;  // 异常值在 excPos / excVal 中的起始位置
+    uint8_t bitWidth;    // 每个 u[i] 的位宽
+    uint8_t excCount;    // 异常值个数
+} BlockHeader;
+
+/**
+ * 压缩整数列表(只读)
+ *
+ * 包含: 块头数组，位打包数据，异常值，元素数量，块数量
+ */
+typedef struct
+{
+    BlockHeader* headers;
+    uint32_t* words;     // 位打包数据
+    uint8_t* excPos;     // 异常值在块内的位置
+    uint32_t* excVal;    // 异常值
+    int size;
+    int numBlocks;
+} CompressedList;
+
+/* 顺序遍历的迭代器，每次解码一整块 */
+typedef struct
+{
+    CompressedList* list;
+    int index;               // 下一个元素的索引
+    int buf[CBLOCK_SIZE];    // 当前块解码后的元素
+} CompressedIter;
+
+
+CompressedList* newCompressedList(MyList* list);
+void destroyCompressedList(CompressedList* list);
+int sizeCompressedList(CompressedList* list);
+size_t bytesCompressedList(CompressedList* list);
+void decodeBlock(CompressedList* list, int blk, int* out);
+int getCompressedList(CompressedList* list, int index);
+int* toArrayCompressedList(CompressedList* list, int* res);
+void initCompressedIter(CompressedIter* it, CompressedList* list);
+int nextCompressedIter(CompressedIter* it, int* val);
+
+#endif
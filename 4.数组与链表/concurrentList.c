@@ -0,0 +1,257 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "concurrentList.h"
+
+/* 编译命令: gcc -O2 -pthread concurrentList.c -o concurrentList */
+
+/**
+ * 无锁多生产者追加
+ *
+ * pushElement 不是线程安全的，多个线程向同一个 MyList 追加时只能用一把全局锁串行化。
+ * 这里的并发列表让生产者互不阻塞:
+ * 1. 预留: 每个生产者用 CAS 拿到一个独占的索引，无需加锁。
+ * 2. 扩容: 元素存放在大小依次翻倍的数据段中，扩容只是分配新段，已有元素从不移动。
+ *    第一个用到新段的生产者负责分配，用 CAS 安装到段数组;
+ *    同时分配的其他生产者 CAS 失败后释放自己的段，直接使用已安装的段。扩容时没有人需要等待。
+ * 3. 提交: 写入元素后把对应的 ready 标志置 1 (release 语义)。
+ * 4. 读取: 读者从 committed 开始向后检查 ready 标志，把连续写完的元素并入已提交前缀。
+ *    已提交前缀中的元素不会再被修改，地址也不会变化，因此可以得到一致的快照。
+ */
+
+/* 把索引 index 定位到第 k 段的第 offset 个位置 */
+static inline void locate(int index, int* k, int* offset)
+{
+    // 第 k 段起始索引为 SEGMENT_BASE * (2^k - 1)
+    unsigned q = (unsigned)index / SEGMENT_BASE + 1;
+    *k = 31 - __builtin_clz(q);
+    *offset = index - SEGMENT_BASE * ((1 << *k) - 1);
+}
+
+/* 获取第 k 段，不存在时分配并用 CAS 安装 */
+static Segment* getSegment(ConcurrentList* list, int k)
+{
+    Segment* seg = atomic_load_explicit(&list->segments[k], memory_order_acquire);
+    if (seg != NULL)
+        return seg; // 绝大多数调用在这里返回，只有刚跨入新段的生产者才会分配
+
+    // 几个生产者同时跨入新段时会各自分配一段，CAS 失败的一方再释放:
+    // 每段最多多分配 (线程数 - 1) 次。多余的段释放前没有被写过，大段来自 mmap，不会真正占用物理页，
+    // 代价主要是几次系统调用。换来的是扩容时没有任何生产者需要等待。
+    size_t n = (size_t)SEGMENT_BASE << k;
+    Segment* fresh = malloc(sizeof(Segment));
+    fresh->vals = malloc(sizeof(int) * n);
+    fresh->ready = calloc(n, sizeof(atomic_uchar));
+    if (fresh->vals == NULL || fresh->ready == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+
+    Segment* expected = NULL;
+    if (atomic_compare_exchange_strong_explicit(&list->segments[k], &expected, fresh,
+                                                memory_order_acq_rel, memory_order_acquire))
+        return fresh;
+
+    // 其他生产者已经安装了这一段
+    free(fresh->vals);
+    free(fresh->ready);
+    free(fresh);
+    return expected;
+}
+
+
+/* 构造函数 */
+ConcurrentList* newConcurrentList()
+{
+    ConcurrentList* list = malloc(sizeof(ConcurrentList));
+    for (int k = 0; k < MAX_SEGMENTS; k++)
+        atomic_init(&list->segments[k], NULL);
+    atomic_init(&list->reserved, 0);
+    atomic_init(&list->committed, 0);
+
+    return list;
+}
+
+/* 析构函数(调用时不能有其他线程仍在访问) */
+void destroyConcurrentList(ConcurrentList* list)
+{
+    if (list == NULL)
+        return;
+
+    for (int k = 0; k < MAX_SEGMENTS; k++)
+    {
+        Segment* seg = atomic_load(&list->segments[k]);
+        if (seg != NULL)
+        {
+            free(seg->vals);
+            free(seg->ready);
+            free(seg);
+        }
+    }
+    free(list);
+}
+
+/**
+ * 在列表尾部追加元素，可被多个线程同时调用，返回元素的索引
+ *
+ * 元素数量达到上限 CONCURRENT_LIST_MAX 时不预留槽位，返回 -1。
+ * 用 CAS 而不是 atomic_fetch_add 预留，保证 reserved 不会越过上限而溢出。
+ */
+int pushConcurrentList(ConcurrentList* list, int val)
+{
+    int index = atomic_load_explicit(&list->reserved, memory_order_relaxed);
+    do
+    {
+        if (index >= CONCURRENT_LIST_MAX)
+            return -1;
+    } while (!atomic_compare_exchange_weak_explicit(&list->reserved, &index, index + 1,
+                                                    memory_order_relaxed, memory_order_relaxed));
+
+    int k, offset;
+    locate(index, &k, &offset);
+
+    Segment* seg = getSegment(list, k);
+    seg->vals[offset] = val;
+    atomic_store_explicit(&seg->ready[offset], 1, memory_order_release);
+
+    return index;
+}
+
+/* 判断索引 index 处的元素是否已写入完成 */
+static int isReady(ConcurrentList* list, int index)
+{
+    int k, offset;
+    locate(index, &k, &offset);
+    Segment* seg = atomic_load_explicit(&list->segments[k], memory_order_acquire);
+
+    return seg != NULL && atomic_load_explicit(&seg->ready[offset], memory_order_acquire);
+}
+
+/**
+ * 推进并返回已提交前缀的长度
+ *
+ * 前 n 个元素都已写入完成，之后可以安全地读取，不会再发生变化。
+ */
+int committedConcurrentList(ConcurrentList* list)
+{
+    int c = atomic_load_explicit(&list->committed, memory_order_acquire);
+    int reserved = atomic_load_explicit(&list->reserved, memory_order_relaxed);
+
+    int n = c;
+    while (n < reserved && isReady(list, n))
+        n++;
+
+    // 多个读者可能同时推进，committed 只增不减
+    while (c < n && !atomic_compare_exchange_weak_explicit(&list->committed, &c, n,
+                                                           memory_order_acq_rel,
+                                                           memory_order_acquire))
+        ;
+
+    return c > n ? c : n;
+}
+
+/* 访问元素，只能访问已提交前缀中的元素，否则返回 -1 */
+int getConcurrentList(ConcurrentList* list, int index)
+{
+    if (index < 0 || index >= atomic_load_explicit(&list->committed, memory_order_acquire))
+        return -1;
+
+    int k, offset;
+    locate(index, &k, &offset);
+
+    return atomic_load_explicit(&list->segments[k], memory_order_acquire)->vals[offset];
+}
+
+/**
+ * 拷贝已提交前缀的快照
+ *
+ * 返回新分配的数组(由调用者 free)，元素数量写入 size。
+ */
+int* snapshotConcurrentList(ConcurrentList* list, int* size)
+{
+    int n = committedConcurrentList(list);
+    int* res = malloc(sizeof(int) * (n > 0 ? n : 1));
+
+    // 按段整体拷贝
+    int copied = 0;
+    for (int k = 0; copied < n; k++)
+    {
+        Segment* seg = atomic_load_explicit(&list->segments[k], memory_order_acquire);
+        int len = SEGMENT_BASE << k;
+        if (len > n - copied)
+            len = n - copied;
+        for (int i = 0; i < len; i++)
+            res[copied + i] = seg->vals[i];
+        copied += len;
+    }
+    *size = n;
+
+    return res;
+}
+
+
+#define NUM_THREADS 4
+#define PUSH_PER_THREAD 1000000
+
+typedef struct
+{
+    ConcurrentList* list;
+    int id;
+} ProducerArg;
+
+/* 生产者线程: 追加 id * PUSH_PER_THREAD + i */
+static void* producer(void* p)
+{
+    ProducerArg* arg = p;
+    for (int i = 0; i < PUSH_PER_THREAD; i++)
+    {
+        pushConcurrentList(arg->list, arg->id * PUSH_PER_THREAD + i);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    ConcurrentList* list = newConcurrentList();
+
+    pthread_t threads[NUM_THREADS];
+    ProducerArg args[NUM_THREADS];
+    for (int t = 0; t < NUM_THREADS; t++)
+    {
+        args[t].list = list;
+        args[t].id = t;
+        pthread_create(&threads[t], NULL, producer, &args[t]);
+    }
+
+    // 生产者运行期间读取快照
+    int n;
+    int* snapshot = snapshotConcurrentList(list, &n);
+    printf("Snapshot while producing: %d elements\n", n);
+    free(snapshot);
+
+    for (int t = 0; t < NUM_THREADS; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    // 校验: 元素数量正确，且每个线程写入的元素保持各自的顺序
+    snapshot = snapshotConcurrentList(list, &n);
+    int last[NUM_THREADS];
+    for (int t = 0; t < NUM_THREADS; t++)
+        last[t] = -1;
+    int ordered = 1;
+    for (int i = 0; i < n; i++)
+    {
+        int t = snapshot[i] / PUSH_PER_THREAD;
+        if (snapshot[i] <= last[t])
+            ordered = 0;
+        last[t] = snapshot[i];
+    }
+    printf("Final snapshot: %d elements, per-thread order kept: %d\n", n, ordered); // 4000000, 1
+    free(snapshot);
+
+    destroyConcurrentList(list);
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#ifndef CONCURRENT_LIST_H
+#define CONCURRENT_LIST_H
+
+#include <limits.h>
+#include <stdatomic.h>
+
+/* 第 0 段的元素个数，之后每段翻倍 */
+#define SEGMENT_BASE 1024
+/* 段数上限，足以容纳 int 范围内的所有索引 */
+#define MAX_SEGMENTS 32
+/* 元素数量上限: 索引和 reserved 都是 int */
+#define CONCURRENT_LIST_MAX INT_MAX
+
+/**
+ * 数据段
+ *
+ * vals 存放元素，ready[i] 为 1 表示 vals[i] 已经写入完成。
+ */
+typedef struct
+{
+    int* vals;
+    atomic_uchar* ready;
+} Segment;
+
+/**
+ * 多生产者并发追加列表
+ *
+ * 包含: 数据段指针数组，已预留的元素数量，已提交(可读)的元素数量
+ */
+typedef struct
+{
+    _Atomic(Segment*) segments[MAX_SEGMENTS]; // 第 k 段容纳 SEGMENT_BASE * 2^k 个元素
+    atomic_int reserved;   // 已被生产者预留的槽位数量
+    atomic_int committed;  // 前 committed 个元素均已写入完成
+} ConcurrentList;
+
+
+ConcurrentList* newConcurrentList();
+void destroyConcurrentList(ConcurrentList* list);
+int pushConcurrentList(ConcurrentList* list, int val);
+int committedConcurrentList(ConcurrentList* list);
+int getConcurrentList(ConcurrentList* list, int index);
+int* snapshotConcurrentList(ConcurrentList* list, int* size);
+
+#endif
@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include "genericList.h"
+
+/* 编译命令: gcc genericList.c -o genericList */
+
+/**
+ * 泛型列表示例
+ *
+ * 同一份 MYLIST_DEFINE 模板分别实例化出 double 列表和结构体列表，
+ * 不再需要为每种元素类型复制一份 list.c。
+ */
+
+/* 二维坐标 */
+typedef struct
+{
+    int x;
+    int y;
+} Point;
+
+MYLIST_DEFINE(DoubleList, double)
+MYLIST_DEFINE(PointList, Point)
+
+
+int main(void)
+{
+    /**
+     * double 列表测试
+     */
+    DoubleList* dlist = newDoubleList();
+    for (int i = 0; i < 20; i++)
+    {
+        pushDoubleList(dlist, i * 0.5);
+    }
+    insertDoubleList(dlist, 0, -1.0);
+    setDoubleList(dlist, 1, 3.14);
+
+    printf("[");
+    for (int i = 0; i < sizeDoubleList(dlist); i++)
+    {
+        printf("%.2f", getDoubleList(dlist, i));
+        if (i != sizeDoubleList(dlist) - 1)
+            printf(", ");
+    }
+    printf("]\n\n"); // [-1.00, 3.14, 0.50, ..., 9.50]
+
+    /**
+     * 结构体列表测试
+     */
+    PointList* plist = newPointList();
+    for (int i = 0; i < 5; i++)
+    {
+        Point p = {i, i * i};
+        pushPointList(plist, p);
+    }
+
+    Point removed = {0, 0};
+    delPointList(plist, 2, &removed);
+    printf("Removed: (%d, %d)\n", removed.x, removed.y); // (2, 4)
+
+    Point last = getPointList(plist, sizePointList(plist) - 1);
+    printf("Last: (%d, %d), size: %d\n", last.x, last.y, sizePointList(plist)); // (4, 16), 4
+
+    // 销毁
+    destroyDoubleList(dlist);
+    destroyPointList(plist);
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+#ifndef GENERIC_LIST_H
+#define GENERIC_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * 泛型列表模板
+ *
+ * MyList 的元素类型固定为 int, 需要存储 double、指针或小结构体时只能复制一份 list.c。
+ * MYLIST_DEFINE(name, T) 在编译期为元素类型 T 生成一个专用的列表类型 name 及其全部操作:
+ *
+ *   new##name / destroy##name / size##name / capacity##name / extendCapacity##name
+ *   get##name / set##name / push##name / insert##name / del##name / toArray##name
+ *
+ * 所有函数都是 static inline, get##name / set##name 会被编译器内联为直接的读写指令，
+ * 不需要函数调用，也没有 void* 的间接访问和装箱开销。
+ * get##name / set##name 不做越界检查，调用者需保证 0 <= index < size。
+ *
+ * 用法:
+ *   MYLIST_DEFINE(DoubleList, double)
+ *   DoubleList* list = newDoubleList();
+ *   pushDoubleList(list, 3.14);
+ */
+#define MYLIST_DEFINE(name, T)                                                  \
+                                                                                \
+typedef struct                                                                  \
+{                                                                               \
+    T* arr;          /* 数组，存储列表元素 */                                   \
+    int capacity;    /* 列表的最大容量 */                                       \
+    int size;        /* 列表中的元素数量 */                                     \
+    int extendRadio; /* 每次扩容的倍数 */                                       \
+} name;                                                                         \
+                                                                                \
+/* 构造函数 */                                                                  \
+static inline name* new##name(void)                                             \
+{                                                                               \
+    name* list = (name*)malloc(sizeof(name));                                   \
+    list->capacity = 10;                                                        \
+    list->arr = (T*)malloc(sizeof(T) * list->capacity);                         \
+    list->size = 0;                                                             \
+    list->extendRadio = 2;                                                      \
+    return list;                                                                \
+}                                                                               \
+                                                                                \
+/* 析构函数 */                                                                  \
+static inline void destroy##name(name* list)                                    \
+{                                                                               \
+    if (list != NULL)                                                           \
+    {                                                                           \
+        free(list->arr);                                                        \
+        free(list);                                                             \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+/* 获取列表长度 */                                                              \
+static inline int size##name(name* list)                                        \
+{                                                                               \
+    return list->size;                                                          \
+}                                                                               \
+                                                                                \
+/* 获取列表容量 */                                                              \
+static inline int capacity##name(name* list)                                    \
+{                                                                               \
+    return list->capacity;                                                      \
+}                                                                               \
+                                                                                \
+/* 扩容列表: 与 MyList 一致，使用 realloc 尽量原地扩展 */                       \
+static inline void extendCapacity##name(name* list)                             \
+{                                                                               \
+    int newCapacity = list->capacity * list->extendRadio;                       \
+    T* extend = (T*)realloc(list->arr, sizeof(T) * (size_t)newCapacity);        \
+    if (extend == NULL)                                                         \
+    {                                                                           \
+        fprintf(stderr, "Memory allocation failed!\n");                         \
+        exit(1);                                                                \
+    }                                                                           \
+    list->arr = extend;                                                         \
+    list->capacity = newCapacity;                                               \
+}                                                                               \
+                                                                                \
+/* 访问元素(不做越界检查) */                                                    \
+static inline T get##name(name* list, int index)                                \
+{                                                                               \
+    return list->arr[index];                                                    \
+}                                                                               \
+                                                                                \
+/* 更新元素(不做越界检查) */                                                    \
+static inline void set##name(name* list, int index, T val)                      \
+{                                                                               \
+    list->arr[index] = val;                                                     \
+}                                                                               \
+                                                                                \
+/* 在列表尾部追加元素 */                                                        \
+static inline void push##name(name* list, T val)                                \
+{                                                                               \
+    if (list->size == list->capacity)                                           \
+        extendCapacity##name(list);                                             \
+    list->arr[list->size++] = val;                                              \
+}                                                                               \
+                                                                                \
+/* 在列表中插入元素 */                                                          \
+static inline void insert##name(name* list, int index, T val)                   \
+{                                                                               \
+    if (index < 0 || index > list->size)                                        \
+        exit(1);                                                                \
+    if (list->size == list->capacity)                                           \
+        extendCapacity##name(list);                                             \
+    memmove(list->arr + index + 1, list->arr + index,                           \
+            sizeof(T) * (size_t)(list->size - index));                          \
+    list->arr[index] = val;                                                     \
+    list->size++;                                                               \
+}                                                                               \
+                                                                                \
+/* 删除元素，被删除的元素写入 out(可为 NULL)，越界返回 -1 */                    \
+static inline int del##name(name* list, int index, T* out)                      \
+{                                                                               \
+    if (index < 0 || index >= list->size)                                       \
+        return -1;                                                              \
+    if (out != NULL)                                                            \
+        *out = list->arr[index];                                                \
+    memmove(list->arr + index, list->arr + index + 1,                           \
+            sizeof(T) * (size_t)(list->size - index - 1));                      \
+    list->size--;                                                               \
+    return 0;                                                                   \
+}                                                                               \
+                                                                                \
+/* 将列表转换为数组 */                                                          \
+static inline T* toArray##name(name* list)                                      \
+{                                                                               \
+    return list->arr;                                                           \
+}
+
+#endif
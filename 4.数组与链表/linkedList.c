@@ -1,5 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
+#include "nodePool.h"
+
+/* 编译命令: gcc linkedList.c -o linkedList */
 
 /**
  * 链表节点结构体
@@ -117,6 +121,50 @@ void freeNode(ListNode* head)
 }
 
 
+/**
+ * 使用内存池创建节点
+ *
+ * 大量创建节点时，newNode 每个节点调用一次 malloc，分配器的开销占了建表时间的大部分。
+ * 内存池从 slab 中顺序切出节点，相邻创建的节点在内存中也相邻，遍历时缓存命中率更高。
+ */
+ListNode* newNodeFromPool(NodePool* pool, int val)
+{
+    ListNode* node = (ListNode*)poolAlloc(pool);
+    node->val = val;
+    node->next = NULL;
+
+    return node;
+}
+
+
+/* 删除节点 n0 之后的首个节点，并放回内存池 */
+void deleteNodeToPool(NodePool* pool, ListNode* n0)
+{
+    if (!n0->next)
+        return;
+
+    ListNode* P = n0->next;
+    n0->next = P->next;
+    poolFree(pool, P);
+}
+
+
+/**
+ * 把链表的全部节点放回内存池
+ *
+ * 内存池只存放这一个链表时，直接调用 resetNodePool 即可在 O(1) 时间内释放全部节点。
+ */
+void freeNodeToPool(NodePool* pool, ListNode* head)
+{
+    while (head)
+    {
+        ListNode* next = head->next;
+        poolFree(pool, head);
+        head = next;
+    }
+}
+
+
 int main(void)
 {
     /**
@@ -176,5 +224,46 @@ int main(void)
      */
     freeNode(n0);
 
+    /**
+     * 内存池示例
+     *
+     * 分别用 malloc 和内存池建立 100 万个节点的链表，再全部释放
+     */
+    int n = 1000000;
+    clock_t start = clock();
+    ListNode* head = NULL;
+    for (int i = 0; i < n; i++)
+    {
+        ListNode* node = newNode(i);
+        node->next = head;
+        head = node;
+    }
+    freeNode(head);
+    printf("malloc: %.3fs\n", (double)(clock() - start) / CLOCKS_PER_SEC);
+
+    NodePool* pool = newNodePool(sizeof(ListNode), 0);
+    start = clock();
+    for (int round = 0; round < 2; round++) // 第二轮复用第一轮的 slab
+    {
+        head = NULL;
+        for (int i = 0; i < n; i++)
+        {
+            ListNode* node = newNodeFromPool(pool, i);
+            node->next = head;
+            head = node;
+        }
+        resetNodePool(pool); // O(1) 释放整个链表
+    }
+    printf("pool (2 rounds): %.3fs, slabs: %lld\n", (double)(clock() - start) / CLOCKS_PER_SEC,
+           pool->slabCount); // 245 个 slab
+
+    // 删除的节点被后续分配复用
+    head = newNodeFromPool(pool, 1);
+    head->next = newNodeFromPool(pool, 2);
+    ListNode* removed = head->next;
+    deleteNodeToPool(pool, head);
+    printf("Node reused: %d\n", newNodeFromPool(pool, 3) == removed); // 1
+    destroyNodePool(pool);
+
     return 0;
 }
@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+
+/* 编译命令: gcc listTest.c list.c -o listTest */
+
+
+int main(void)
+{
+    /**
+     * 列表测试
+     */
+
+    MyList* list = newMyList();
+
+    // 在列表尾部添加元素
+    pushElement(list, 1);
+    pushElement(list, 2);
+    pushElement(list, 3);
+    pushElement(list, 4);
+    pushElement(list, 5);
+
+    arrPrint(list->arr, list->size); // [1, 2, 3, 4, 5]
+
+    // 插入元素
+    insertElement(list, 3, 6);
+    arrPrint(list->arr, list->size); // [1, 2, 3, 6, 4, 5]
+
+    // 删除元素
+    delElement(list, 3);
+    arrPrint(list->arr, list->size); // [1, 2, 3, 4, 5]
+
+    // 访问元素
+    int num = getElement(list, 3);
+    printf("Num: %d\n", num);
+
+    // 更新元素
+    setElement(list, 3, 6);
+    arrPrint(list->arr, list->size); // [1, 2, 3, 6, 5]
+
+    // 批量操作
+    int vals[3] = {7, 8, 9};
+    pushElements(list, vals, 3);
+    arrPrint(list->arr, list->size); // [1, 2, 3, 6, 5, 7, 8, 9]
+    insertRange(list, 1, vals, 3);
+    arrPrint(list->arr, list->size); // [1, 7, 8, 9, 2, 3, 6, 5, 7, 8, 9]
+    deleteRange(list, 1, 3);
+    arrPrint(list->arr, list->size); // [1, 2, 3, 6, 5, 7, 8, 9]
+
+    // 测试扩容机制
+    for(int i = 0; i < 100; i++)
+    {
+        pushElement(list, i);
+    }
+    arrPrint(list->arr, list->size); // 成功
+
+    // 测试间隙缓冲区: 在光标附近连续插入、删除
+    MyList* text = newMyList();
+    for (int i = 0; i < 10; i++)
+    {
+        pushElement(text, i);
+    }
+    setGapBuffer(text, 1);
+    for (int i = 0; i < 3; i++)
+    {
+        insertElement(text, 5 + i, 100 + i); // 光标从 5 向后移动
+    }
+    delElement(text, 4); // 光标退格
+    printf("Element 4: %d\n", getElement(text, 4)); // 100
+    arrPrint(toArray(text), size(text)); // [0, 1, 2, 3, 100, 101, 102, 5, 6, 7, 8, 9]
+    destoryMyList(text);
+
+    // 测试保存与加载: 加载时直接映射文件，不解析也不拷贝
+    saveMyList(list, "list.bin");
+    MyList* loaded = loadMyList("list.bin");
+    setElement(loaded, 0, 100); // 写时复制，不会修改文件
+    printf("Loaded size: %d, first: %d, storage: %s\n", size(loaded), getElement(loaded, 0),
+           loaded->storage == STORAGE_FILE ? "file" : "heap"); // 108, 100, file
+    pushElement(loaded, 100); // 扩容时拷贝到堆上
+    printf("Storage after push: %s\n", loaded->storage == STORAGE_FILE ? "file" : "heap"); // heap
+    destoryMyList(loaded);
+    remove("list.bin");
+
+    // 测试写时复制: 克隆只增加引用计数，第一次写入时才拷贝
+    MyList* fork = cloneMyList(list);
+    printf("Shared: %d\n", fork->arr == list->arr); // 1
+    setElement(fork, 0, 42);
+    printf("Shared after write: %d, first: %d, %d\n",
+           fork->arr == list->arr, getElement(fork, 0), getElement(list, 0)); // 0, 42, 1
+    destoryMyList(fork);
+
+    // 测试内部存储: 定义在栈上的小列表全程不分配堆内存
+    MyList smallList;
+    initMyList(&smallList);
+    for (int i = 0; i < MYLIST_INLINE_SIZE; i++)
+    {
+        pushElement(&smallList, i);
+    }
+    printf("Storage: %s\n", smallList.storage == STORAGE_INLINE ? "inline" : "heap"); // inline
+    pushElement(&smallList, MYLIST_INLINE_SIZE); // 溢出后转移到堆上
+    printf("Storage: %s\n", smallList.storage == STORAGE_INLINE ? "inline" : "heap"); // heap
+    releaseMyList(&smallList);
+
+    // 测试大列表扩容: 超过 MMAP_THRESHOLD 后改用 mremap, 不再拷贝数据
+    MyList* bigList = newMyList();
+    for (int i = 0; i < 32 * 1024 * 1024; i++)
+    {
+        pushElement(bigList, i);
+    }
+    printf("Storage: %s, copied bytes: %lld\n",
+           bigList->storage == STORAGE_MMAP ? "mmap" : "heap", copiedBytes(bigList));
+
+    // 测试缩容: 元素数量低于容量的 1/4 后自动缩容
+    deleteRange(bigList, 0, size(bigList) - 100);
+    printf("Size: %d, capacity after delete: %d\n", size(bigList), capacity(bigList)); // 100, 320
+    shrinkToFit(bigList);
+    printf("Capacity after shrinkToFit: %d\n", capacity(bigList)); // 100
+    destoryMyList(bigList);
+
+    // 销毁
+    destoryMyList(list);
+
+#ifdef MYLIST_STATS
+    // 打印容量调整统计(编译命令: gcc -DMYLIST_STATS listTest.c list.c -o listTest)
+    dumpListStats(stdout);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,369 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "listView.h"
+
+/* 编译命令: gcc listView.c list.c -o listView */
+
+/**
+ * 列表视图
+ *
+ * toArray / readArray 直接返回内部数组的指针，想把其中一段交给其他模块时只能拷贝，或者传递裸的指针和长度。
+ * 视图用 (base, offset, length, stride) 描述一段元素，切片、逆序、按步长取元素都不需要拷贝。
+ *
+ * 列表扩容时内部数组可能被搬迁，旧指针随之失效。MyList 的 generation 在数组搬迁或元素物理位置改变时递增，
+ * 视图记录建立时的 generation，每次访问前进行比较，从而发现失效的视图，而不是静默地读取已释放的内存。
+ */
+
+/* 视图中第 index 个元素的地址 */
+static inline int* viewAddr(ListView* view, int index)
+{
+    return view->base + view->offset + (long)index * view->stride;
+}
+
+
+/* 访问失效的视图属于程序错误，直接终止 */
+static void checkView(ListView* view)
+{
+    if (!isViewValid(view)) {
+        fprintf(stderr, "Stale list view!\n");
+        exit(1);
+    }
+}
+
+
+/* 整个列表的视图(间隙缓冲区模式下会先合并间隙) */
+ListView viewMyList(MyList* list)
+{
+    ListView view;
+    view.base = (int*)readArray(list); // 只读合并间隙，写入时由 setView 处理共享数组
+    view.offset = 0;
+    view.length = size(list);
+    view.stride = 1;
+    view.owner = list;
+    view.generation = list->generation;
+
+    return view;
+}
+
+
+/* 普通数组的视图 */
+ListView viewArray(int* arr, int size)
+{
+    ListView view;
+    view.base = arr;
+    view.offset = 0;
+    view.length = size;
+    view.stride = 1;
+    view.owner = NULL;
+    view.generation = 0;
+
+    return view;
+}
+
+
+/* mmap 映射内存的视图，按 int 数组解释 */
+ListView viewMapped(void* addr, size_t bytes)
+{
+    return viewArray((int*)addr, (int)(bytes / sizeof(int)));
+}
+
+
+/**
+ * 切片
+ *
+ * 取视图中从 start 开始、间隔 stride 的 length 个元素，结果仍是原底层数组上的视图。
+ * 切片超出原视图范围时终止程序。
+ */
+ListView sliceView(ListView view, int start, int length, int stride)
+{
+    checkView(&view);
+    long last = start + (long)(length - 1) * stride;
+    if (length < 0 || stride == 0 ||
+        (length > 0 && (start < 0 || start >= view.length || last < 0 || last >= view.length))) {
+        fprintf(stderr, "Slice out of range!\n");
+        exit(1);
+    }
+
+    ListView slice = view;
+    slice.offset = view.offset + start * view.stride;
+    slice.length = length;
+    slice.stride = view.stride * stride;
+
+    return slice;
+}
+
+
+/**
+ * 判断视图是否仍然有效
+ *
+ * 所属列表的内部数组没有搬迁，并且视图中的元素都没有因删除而超出列表长度。
+ */
+int isViewValid(ListView* view)
+{
+    if (view->owner == NULL || view->length == 0)
+        return 1;
+    if (view->owner->generation != view->generation)
+        return 0;
+
+    long first = view->offset;
+    long last = view->offset + (long)(view->length - 1) * view->stride;
+    long lo = first < last ? first : last;
+    long hi = first < last ? last : first;
+
+    return lo >= 0 && hi < size(view->owner);
+}
+
+
+/* 获取视图长度 */
+int lengthView(ListView* view)
+{
+    return view->length;
+}
+
+
+/* 访问元素，越界返回 -1 */
+int getView(ListView* view, int index)
+{
+    checkView(view);
+    if (index >= 0 && index < view->length)
+    {
+        return *viewAddr(view, index);
+    }
+
+    return -1;
+}
+
+
+/* 更新元素，写入底层数组，成功返回 0，越界返回 -1 */
+int setView(ListView* view, int index, int val)
+{
+    checkView(view);
+    if (index >= 0 && index < view->length)
+    {
+        // 列表与克隆共享数组时先拷贝一份独占的数组，视图随之指向新数组(共享数组没有间隙，布局不变)
+        if (view->owner != NULL && view->owner->storage == STORAGE_SHARED)
+        {
+            detachMyList(view->owner);
+            view->base = view->owner->arr;
+            view->generation = view->owner->generation;
+        }
+        *viewAddr(view, index) = val;
+        return 0;
+    }
+
+    return -1;
+}
+
+
+/* 查找元素，返回在视图中的索引，未找到返回 -1 */
+int findView(ListView* view, int target)
+{
+    checkView(view);
+    int* p = viewAddr(view, 0);
+    for (int i = 0; i < view->length; i++, p += view->stride)
+    {
+        if (*p == target)
+            return i;
+    }
+
+    return -1;
+}
+
+
+/* 统计 target 出现的次数 */
+int countView(ListView* view, int target)
+{
+    checkView(view);
+    int count = 0;
+    int* p = viewAddr(view, 0);
+    if (view->stride == 1)
+    {
+        // 连续视图单独处理，便于编译器向量化
+        for (int i = 0; i < view->length; i++)
+            count += p[i] == target;
+        return count;
+    }
+    for (int i = 0; i < view->length; i++, p += view->stride)
+        count += *p == target;
+
+    return count;
+}
+
+
+/* 元素和(64 位) */
+long long sumView(ListView* view)
+{
+    checkView(view);
+    long long sum = 0;
+    int* p = viewAddr(view, 0);
+    if (view->stride == 1)
+    {
+        for (int i = 0; i < view->length; i++)
+            sum += p[i];
+        return sum;
+    }
+    for (int i = 0; i < view->length; i++, p += view->stride)
+        sum += *p;
+
+    return sum;
+}
+
+
+/* 最小值，空视图返回 INT_MAX */
+int minView(ListView* view)
+{
+    checkView(view);
+    int res = INT_MAX;
+    int* p = viewAddr(view, 0);
+    for (int i = 0; i < view->length; i++, p += view->stride)
+        res = *p < res ? *p : res;
+
+    return res;
+}
+
+
+/* 最大值，空视图返回 INT_MIN */
+int maxView(ListView* view)
+{
+    checkView(view);
+    int res = INT_MIN;
+    int* p = viewAddr(view, 0);
+    for (int i = 0; i < view->length; i++, p += view->stride)
+        res = *p > res ? *p : res;
+
+    return res;
+}
+
+
+/* 归约: 依次计算 acc = op(acc, 元素)，acc 的初值为 init */
+long long reduceView(ListView* view, long long init, long long (*op)(long long, int))
+{
+    checkView(view);
+    long long acc = init;
+    int* p = viewAddr(view, 0);
+    for (int i = 0; i < view->length; i++, p += view->stride)
+        acc = op(acc, *p);
+
+    return acc;
+}
+
+
+/* 把视图中的元素拷贝到 res 中(res 至少能容纳 length 个元素) */
+int* copyView(ListView* view, int* res)
+{
+    checkView(view);
+    int* p = viewAddr(view, 0);
+    for (int i = 0; i < view->length; i++, p += view->stride)
+        res[i] = *p;
+
+    return res;
+}
+
+
+/* 初始化迭代器 */
+void initViewIter(ViewIter* it, ListView* view)
+{
+    checkView(view);
+    it->view = view;
+    it->index = 0;
+}
+
+
+/* 取出下一个元素，遍历结束时返回 0 */
+int nextViewIter(ViewIter* it, int* val)
+{
+    if (it->index >= it->view->length)
+        return 0;
+
+    checkView(it->view);
+    *val = *viewAddr(it->view, it->index);
+    it->index++;
+
+    return 1;
+}
+
+
+static long long sumSquares(long long acc, int val)
+{
+    return acc + (long long)val * val;
+}
+
+
+int main(void)
+{
+    /**
+     * 列表上的视图
+     */
+    MyList* list = newMyList();
+    for (int i = 0; i < 10; i++)
+        pushElement(list, i);
+
+    ListView all = viewMyList(list);
+    ListView evens = sliceView(all, 0, 5, 2);       // 0 2 4 6 8
+    ListView reversed = sliceView(all, 9, 10, -1);  // 9 8 ... 0
+    ListView middle = sliceView(reversed, 2, 3, 2); // 7 5 3
+
+    printf("Sum of evens: %lld\n", sumView(&evens));   // 20
+    printf("Find 5 in reversed: %d\n", findView(&reversed, 5)); // 4
+    printf("Min / max of middle: %d %d\n", minView(&middle), maxView(&middle)); // 3 7
+    printf("Sum of squares: %lld\n", reduceView(&all, 0, sumSquares)); // 285
+
+    int val;
+    ViewIter it;
+    initViewIter(&it, &middle);
+    while (nextViewIter(&it, &val))
+        printf("%d ", val); // 7 5 3
+    printf("\n");
+
+    // 通过视图写入会修改列表本身
+    setView(&evens, 1, 100);
+    printf("Element 2 of list: %d\n", getElement(list, 2)); // 100
+
+    // 先建立视图再克隆: 通过视图写入时原列表拷贝出独占的数组，克隆不受影响
+    MyList* shared = newMyList();
+    for (int i = 0; i < 100; i++)
+        pushElement(shared, i);
+    ListView sharedView = viewMyList(shared);
+    MyList* clone = cloneMyList(shared);
+    setView(&sharedView, 2, 200);
+    printf("Element 2 of list / clone: %d %d\n", getElement(shared, 2), getElement(clone, 2)); // 200 2
+    printf("View valid after detach: %d\n", isViewValid(&sharedView)); // 1
+    destoryMyList(clone);
+    destoryMyList(shared);
+
+    // 扩容搬迁内部数组后，视图失效
+    for (int i = 0; i < 1000; i++)
+        pushElement(list, i);
+    printf("View valid after growth: %d\n", isViewValid(&evens)); // 0
+    all = viewMyList(list);
+    printf("New view valid: %d, length: %d\n", isViewValid(&all), lengthView(&all)); // 1, 1010
+
+    /**
+     * 普通数组与 mmap 映射内存上的视图
+     */
+    int arr[6] = {5, 1, 4, 1, 5, 9};
+    ListView arrView = viewArray(arr, 6);
+    printf("Count of 1: %d\n", countView(&arrView, 1)); // 2
+
+    size_t bytes = (size_t)sysconf(_SC_PAGESIZE);
+    int* mapped = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < bytes / sizeof(int); i++)
+        mapped[i] = (int)i;
+    ListView mapView = viewMapped(mapped, bytes);
+    ListView tail = sliceView(mapView, lengthView(&mapView) - 4, 4, 1);
+    int res[4];
+    copyView(&tail, res);
+    arrPrint(res, 4); // 页大小为 4096 时: [1020, 1021, 1022, 1023]
+    munmap(mapped, bytes);
+
+    destoryMyList(list);
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#ifndef LIST_VIEW_H
+#define LIST_VIEW_H
+
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * 列表视图(不拷贝元素)
+ *
+ * 第 i 个元素位于 base[offset + i * stride]，stride 可以为负数(逆序视图)。
+ * 视图可以建立在 MyList、普通数组或 mmap 映射的内存上。
+ * 建立在 MyList 上的视图记录列表的 generation，列表内部数组搬迁(如 extendCapacity)后视图失效。
+ * 列表与克隆共享数组时，setView 先让所属列表拷贝出独占的数组，并把视图重新指向新数组。
+ */
+typedef struct
+{
+    int* base;             // 底层数组
+    int offset;            // 第一个元素在 base 中的位置
+    int length;            // 元素数量
+    int stride;            // 相邻元素在 base 中的间隔
+    MyList* owner;         // 所属列表，普通数组和映射内存为 NULL
+    unsigned generation;   // 建立视图时列表的 generation
+} ListView;
+
+/* 视图的迭代器 */
+typedef struct
+{
+    ListView* view;
+    int index;   // 下一个元素的索引
+} ViewIter;
+
+
+ListView viewMyList(MyList* list);
+ListView viewArray(int* arr, int size);
+ListView viewMapped(void* addr, size_t bytes);
+ListView sliceView(ListView view, int start, int length, int stride);
+int isViewValid(ListView* view);
+int lengthView(ListView* view);
+int getView(ListView* view, int index);
+int setView(ListView* view, int index, int val);
+int findView(ListView* view, int target);
+int countView(ListView* view, int target);
+long long sumView(ListView* view);
+int minView(ListView* view);
+int maxView(ListView* view);
+long long reduceView(ListView* view, long long init, long long (*op)(long long, int));
+int* copyView(ListView* view, int* res);
+void initViewIter(ViewIter* it, ListView* view);
+int nextViewIter(ViewIter* it, int* val);
+
+#endif
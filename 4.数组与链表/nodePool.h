@@ -0,0 +1,295 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "alignedAlloc.h"
+#ifdef NODEPOOL_THREADS
+#include <pthread.h>
+#endif
+
+/**
+ * 链表节点内存池
+ *
+ * 每个节点单独 malloc / free 时，分配器的开销远大于初始化一个 16 字节的节点，
+ * 节点还会散落在堆的各处，遍历链表时缓存命中率很低。内存池一次分配一大块内存(slab)，
+ * 从中顺序切出节点，相邻创建的节点在内存中也相邻。
+ * 1. 分配: 优先从空闲链表取出，其次从当前 slab 顺序切分，slab 用完后换到下一个 slab。
+ * 2. 释放: 节点放回空闲链表，空闲节点的前几个字节用来存放下一个空闲节点的指针(侵入式)，不需要额外内存。
+ * 3. 重置: 一次性释放池中的全部节点，只需把切分位置退回第一个 slab，时间复杂度为 O(1)，slab 留作复用。
+ *
+ * 内存池只关心节点大小，可用于任意节点类型(节点不小于一个指针)，
+ * 例如 linkedList.c 和栈、队列中的 ListNode。
+ *
+ * 编译时定义 NODEPOOL_THREADS 后，内存池由互斥锁保护，可以被多个线程共享;
+ * 每个线程再使用自己的 NodeCache 缓存一批节点，大多数分配和释放不需要加锁(示例见 nodePoolTest.c)。
+ */
+
+/* 默认每个 slab 包含的节点数 */
+#define NODES_PER_SLAB 4096
+/* 线程缓存的容量，缓存空时一次取回、满时一次归还一半 */
+#define NODE_CACHE_SIZE 64
+
+/* slab 头部，后面紧跟节点 */
+typedef struct Slab
+{
+    struct Slab* next;
+} Slab;
+
+/* 空闲节点: 复用节点自身的内存 */
+typedef struct FreeNode
+{
+    struct FreeNode* next;
+} FreeNode;
+
+typedef struct
+{
+    size_t nodeSize;      // 节点大小(已按指针对齐)
+    int nodesPerSlab;     // 每个 slab 的节点数
+    Slab* slabs;          // 全部 slab 组成的链表
+    Slab* current;        // 正在切分的 slab
+    char* bump;           // 当前 slab 中下一个未使用的节点
+    char* bumpEnd;        // 当前 slab 的末尾
+    FreeNode* freeList;   // 已释放的节点
+    long long slabCount;  // slab 数量
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_t lock;
+#endif
+} NodePool;
+
+/* 线程缓存，由使用它的线程独占 */
+typedef struct
+{
+    NodePool* pool;
+    int count;
+    void* nodes[NODE_CACHE_SIZE];
+} NodeCache;
+
+
+/* slab 头部按缓存行对齐，第一个节点也从缓存行边界开始 */
+static inline size_t slabHeaderSize()
+{
+    return alignUp(sizeof(Slab), CACHE_LINE);
+}
+
+
+/* 初始化内存池，nodesPerSlab 为 0 时使用 NODES_PER_SLAB */
+static inline void initNodePool(NodePool* pool, size_t nodeSize, int nodesPerSlab)
+{
+    if (nodeSize < sizeof(FreeNode))
+        nodeSize = sizeof(FreeNode);
+    pool->nodeSize = alignUp(nodeSize, sizeof(void*));
+    pool->nodesPerSlab = nodesPerSlab > 0 ? nodesPerSlab : NODES_PER_SLAB;
+    pool->slabs = NULL;
+    pool->current = NULL;
+    pool->bump = NULL;
+    pool->bumpEnd = NULL;
+    pool->freeList = NULL;
+    pool->slabCount = 0;
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_init(&pool->lock, NULL);
+#endif
+}
+
+
+/* 构造函数 */
+static inline NodePool* newNodePool(size_t nodeSize, int nodesPerSlab)
+{
+    NodePool* pool = (NodePool*)malloc(sizeof(NodePool));
+    if (pool == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    initNodePool(pool, nodeSize, nodesPerSlab);
+
+    return pool;
+}
+
+
+/* 析构函数: 释放全部 slab，池中的节点全部失效 */
+static inline void destroyNodePool(NodePool* pool)
+{
+    if (pool == NULL)
+        return;
+
+    Slab* slab = pool->slabs;
+    while (slab != NULL)
+    {
+        Slab* next = slab->next;
+        free(slab);
+        slab = next;
+    }
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_destroy(&pool->lock);
+#endif
+    free(pool);
+}
+
+
+/* 从 slab 的开头开始切分 */
+static inline void useSlab(NodePool* pool, Slab* slab)
+{
+    pool->current = slab;
+    pool->bump = (char*)slab + slabHeaderSize();
+    pool->bumpEnd = pool->bump + pool->nodeSize * (size_t)pool->nodesPerSlab;
+}
+
+
+/* 当前 slab 用完: 换到下一个已有的 slab(重置后复用)，没有时分配新的 slab */
+static inline void nextSlab(NodePool* pool)
+{
+    if (pool->current != NULL && pool->current->next != NULL)
+    {
+        useSlab(pool, pool->current->next);
+        return;
+    }
+
+    Slab* slab = (Slab*)alignedAlloc(slabHeaderSize() + pool->nodeSize * (size_t)pool->nodesPerSlab);
+    if (slab == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    slab->next = NULL;
+    // 新 slab 接在链表末尾，保证重置后按原顺序复用
+    if (pool->current != NULL)
+        pool->current->next = slab;
+    else
+        pool->slabs = slab;
+    pool->slabCount++;
+    useSlab(pool, slab);
+}
+
+
+/* 分配节点(不加锁) */
+static inline void* poolAllocUnlocked(NodePool* pool)
+{
+    if (pool->freeList != NULL)
+    {
+        FreeNode* node = pool->freeList;
+        pool->freeList = node->next;
+        return node;
+    }
+    if (pool->bump == pool->bumpEnd)
+        nextSlab(pool);
+
+    void* node = pool->bump;
+    pool->bump += pool->nodeSize;
+
+    return node;
+}
+
+
+/* 释放节点(不加锁) */
+static inline void poolFreeUnlocked(NodePool* pool, void* node)
+{
+    FreeNode* f = (FreeNode*)node;
+    f->next = pool->freeList;
+    pool->freeList = f;
+}
+
+
+/* 分配一个节点，内容未初始化 */
+static inline void* poolAlloc(NodePool* pool)
+{
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_lock(&pool->lock);
+    void* node = poolAllocUnlocked(pool);
+    pthread_mutex_unlock(&pool->lock);
+    return node;
+#else
+    return poolAllocUnlocked(pool);
+#endif
+}
+
+
+/* 把节点放回内存池 */
+static inline void poolFree(NodePool* pool, void* node)
+{
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_lock(&pool->lock);
+    poolFreeUnlocked(pool, node);
+    pthread_mutex_unlock(&pool->lock);
+#else
+    poolFreeUnlocked(pool, node);
+#endif
+}
+
+
+/**
+ * 重置内存池
+ *
+ * 一次性释放池中的全部节点，时间复杂度为 O(1)。slab 不归还给系统，之后的分配从第一个 slab 重新切分。
+ * 调用前需确保池中的节点都不再使用，多线程时各线程的 NodeCache 也要先清空。
+ */
+static inline void resetNodePool(NodePool* pool)
+{
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_lock(&pool->lock);
+#endif
+    pool->freeList = NULL;
+    if (pool->slabs != NULL)
+        useSlab(pool, pool->slabs);
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_unlock(&pool->lock);
+#endif
+}
+
+
+/* 初始化线程缓存 */
+static inline void initNodeCache(NodeCache* cache, NodePool* pool)
+{
+    cache->pool = pool;
+    cache->count = 0;
+}
+
+
+/* 从线程缓存分配节点，缓存为空时加一次锁取回半个缓存的节点 */
+static inline void* cacheAlloc(NodeCache* cache)
+{
+    if (cache->count == 0)
+    {
+#ifdef NODEPOOL_THREADS
+        pthread_mutex_lock(&cache->pool->lock);
+#endif
+        for (int i = 0; i < NODE_CACHE_SIZE / 2; i++)
+            cache->nodes[cache->count++] = poolAllocUnlocked(cache->pool);
+#ifdef NODEPOOL_THREADS
+        pthread_mutex_unlock(&cache->pool->lock);
+#endif
+    }
+
+    return cache->nodes[--cache->count];
+}
+
+
+/* 把 [from, count) 的节点归还给内存池 */
+static inline void cacheRelease(NodeCache* cache, int from)
+{
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_lock(&cache->pool->lock);
+#endif
+    for (int i = from; i < cache->count; i++)
+        poolFreeUnlocked(cache->pool, cache->nodes[i]);
+#ifdef NODEPOOL_THREADS
+    pthread_mutex_unlock(&cache->pool->lock);
+#endif
+    cache->count = from;
+}
+
+
+/* 把节点放回线程缓存，缓存满时加一次锁归还一半 */
+static inline void cacheFree(NodeCache* cache, void* node)
+{
+    if (cache->count == NODE_CACHE_SIZE)
+        cacheRelease(cache, NODE_CACHE_SIZE / 2);
+    cache->nodes[cache->count++] = node;
+}
+
+
+/* 清空线程缓存，线程退出前调用 */
+static inline void flushNodeCache(NodeCache* cache)
+{
+    cacheRelease(cache, 0);
+}
+
+#endif
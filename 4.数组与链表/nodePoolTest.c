@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "nodePool.h"
+
+/* 编译命令: gcc -O2 -pthread -DNODEPOOL_THREADS nodePoolTest.c -o nodePoolTest */
+
+#ifndef NODEPOOL_THREADS
+#error "nodePoolTest.c 需要在编译时定义 NODEPOOL_THREADS"
+#endif
+
+#define NUM_THREADS 4
+#define NODES_PER_THREAD 100000
+#define ROUNDS 20
+
+/* 链表节点 */
+typedef struct Node
+{
+    int val;
+    struct Node* next;
+} Node;
+
+/* 每个线程的参数 */
+typedef struct
+{
+    NodePool* pool;
+    int id;
+    Node* heads[ROUNDS];   // 每轮建立的链表，交给下一个线程释放
+    long long sum;         // 读回的元素之和
+} Worker;
+
+static Worker workers[NUM_THREADS];
+static pthread_barrier_t barrier;
+
+
+/* 每个线程通过自己的 NodeCache 共享同一个内存池 */
+static void* workerMain(void* p)
+{
+    Worker* w = p;
+    NodeCache cache;
+    initNodeCache(&cache, w->pool);
+
+    // 第一阶段: 每轮建立一个链表，再释放前一半节点，节点在本线程的缓存中循环使用
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        Node* head = NULL;
+        for (int i = 0; i < NODES_PER_THREAD; i++)
+        {
+            Node* node = cacheAlloc(&cache);
+            node->val = w->id;
+            node->next = head;
+            head = node;
+        }
+        for (int i = 0; i < NODES_PER_THREAD / 2; i++)
+        {
+            Node* next = head->next;
+            cacheFree(&cache, head);
+            head = next;
+        }
+        w->heads[r] = head;
+    }
+
+    // 第二阶段: 释放另一个线程建立的链表，节点经由本线程的缓存归还给内存池
+    pthread_barrier_wait(&barrier);
+    Worker* other = &workers[(w->id + 1) % NUM_THREADS];
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        Node* node = other->heads[r];
+        while (node != NULL)
+        {
+            Node* next = node->next;
+            w->sum += node->val;
+            cacheFree(&cache, node);
+            node = next;
+        }
+    }
+
+    flushNodeCache(&cache); // 线程退出前把缓存中的节点全部归还
+    return NULL;
+}
+
+
+/* 统计内存池空闲链表中的节点数 */
+static long long countFreeNodes(NodePool* pool)
+{
+    long long count = 0;
+    for (FreeNode* f = pool->freeList; f != NULL; f = f->next)
+        count++;
+
+    return count;
+}
+
+
+int main(void)
+{
+    NodePool* pool = newNodePool(sizeof(Node), 0);
+    pthread_t threads[NUM_THREADS];
+    pthread_barrier_init(&barrier, NULL, NUM_THREADS);
+
+    for (int t = 0; t < NUM_THREADS; t++)
+    {
+        workers[t].pool = pool;
+        workers[t].id = t;
+        workers[t].sum = 0;
+        pthread_create(&threads[t], NULL, workerMain, &workers[t]);
+    }
+    for (int t = 0; t < NUM_THREADS; t++)
+        pthread_join(threads[t], NULL);
+    pthread_barrier_destroy(&barrier);
+
+    // 线程 t 释放线程 t + 1 的链表，读回的元素之和为 (t + 1) % NUM_THREADS 乘以节点数
+    int correct = 1;
+    long long kept = (long long)ROUNDS * (NODES_PER_THREAD - NODES_PER_THREAD / 2);
+    for (int t = 0; t < NUM_THREADS; t++)
+        correct &= workers[t].sum == kept * ((t + 1) % NUM_THREADS);
+    printf("Values read back correctly: %d\n", correct); // 1
+
+    // 所有节点都回到了内存池: 空闲节点数等于已切分出的节点数
+    long long carved = (long long)(pool->slabCount - 1) * pool->nodesPerSlab +
+                       (pool->bump - ((char*)pool->current + slabHeaderSize())) / (long long)pool->nodeSize;
+    printf("All nodes returned: %d, slabs: %lld\n", countFreeNodes(pool) == carved, pool->slabCount); // 1
+
+    destroyNodePool(pool);
+
+    return 0;
+}
@@ -0,0 +1,540 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "parallelList.h"
+#include "alignedAlloc.h"
+
+/* 编译命令: gcc -O2 -pthread parallelList.c list.c -o parallelList */
+
+/**
+ * MyList 上的并行算法
+ *
+ * 所有算法都运行在一个可复用的线程池上，grain 控制每个任务块的大小:
+ * 块太小时调度开销占比高，块太大时线程间负载不均。grain <= 0 时使用 DEFAULT_GRAIN。
+ *
+ * 1. 并行排序(归并排序):
+ *    (1) 把数组分成若干段，各线程并行对每段排序;
+ *    (2) 逐轮两两归并，段长每轮翻倍。每轮把输出区间按 grain 切块，
+ *        每块通过二分查找(merge path)算出它在两个输入段中的起点，因此最后一轮也能由所有线程并行完成。
+ * 2. 并行前缀和: 先并行求出每块的和，再串行计算块的前缀和，最后各块并行加上偏移量重新扫描。
+ * 3. 并行映射: 各块独立地对每个元素执行 fn。
+ * 4. 并行预留容量: 各线程对自己负责的区间首次写入(touchPages)，物理页分配在该线程所在的 NUMA 节点上。
+ */
+
+
+/* ---------------- 线程池 ---------------- */
+
+/* 领取并执行当前任务的任务块，直到全部领完; 静态划分时只执行编号为 id 的线程负责的区间 */
+static void runChunks(ThreadPool* pool, int id)
+{
+    if (pool->staticSchedule)
+    {
+        int workers = pool->numThreads + 1;
+        int begin = (int)((long long)pool->n * id / workers);
+        int end = (int)((long long)pool->n * (id + 1) / workers);
+        if (begin < end)
+            pool->fn(pool->ctx, begin, end);
+        return;
+    }
+
+    for (;;)
+    {
+        long long begin = __atomic_fetch_add(&pool->next, pool->grain, __ATOMIC_RELAXED);
+        if (begin >= pool->n)
+            break;
+        long long end = begin + pool->grain < pool->n ? begin + pool->grain : pool->n;
+        pool->fn(pool->ctx, (int)begin, (int)end);
+    }
+}
+
+/* 工作线程: 等待新任务，执行完成后通知调用线程 */
+static void* workerLoop(void* p)
+{
+    ThreadPool* pool = p;
+    int id = __atomic_fetch_add(&pool->nextWorkerId, 1, __ATOMIC_RELAXED);
+    int seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;)
+    {
+        while (!pool->stop && pool->generation == seen)
+            pthread_cond_wait(&pool->start, &pool->lock);
+        if (pool->stop)
+            break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        runChunks(pool, id);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->active == 0)
+            pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/* 构造函数: numThreads <= 0 时按 CPU 核数创建(调用线程也参与计算，因此少创建一个) */
+ThreadPool* newThreadPool(int numThreads)
+{
+    if (numThreads <= 0)
+        numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN) - 1;
+    if (numThreads < 0)
+        numThreads = 0;
+
+    ThreadPool* pool = malloc(sizeof(ThreadPool));
+    pool->threads = malloc(sizeof(pthread_t) * (numThreads > 0 ? numThreads : 1));
+    pool->numThreads = numThreads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->generation = 0;
+    pool->active = 0;
+    pool->stop = 0;
+    pool->nextWorkerId = 0;
+
+    for (int t = 0; t < numThreads; t++)
+        pthread_create(&pool->threads[t], NULL, workerLoop, pool);
+
+    return pool;
+}
+
+/* 析构函数 */
+void destroyThreadPool(ThreadPool* pool)
+{
+    if (pool == NULL)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int t = 0; t < pool->numThreads; t++)
+        pthread_join(pool->threads[t], NULL);
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+    free(pool->threads);
+    free(pool);
+}
+
+/* 把任务交给所有工作线程，调用线程也参与，全部完成后返回 */
+static void runTask(ThreadPool* pool, int n, int grain, int staticSchedule, RangeFunc fn, void* ctx)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->n = n;
+    pool->grain = grain;
+    pool->next = 0;
+    pool->staticSchedule = staticSchedule;
+    pool->active = pool->numThreads;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    runChunks(pool, pool->numThreads); // 调用线程也参与，编号排在工作线程之后
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * 并行循环
+ *
+ * 把 [0, n) 切成长度为 grain 的块(每块起点都是 grain 的整数倍)，对每块调用 fn，全部完成后返回。
+ */
+void parallelFor(ThreadPool* pool, int n, int grain, RangeFunc fn, void* ctx)
+{
+    if (n <= 0)
+        return;
+    if (grain <= 0)
+        grain = DEFAULT_GRAIN;
+
+    // 只有一块或没有工作线程时直接在调用线程中执行
+    if (n <= grain || pool->numThreads == 0)
+    {
+        for (long long begin = 0; begin < n; begin += grain)
+            fn(ctx, (int)begin, begin + grain < n ? (int)(begin + grain) : n);
+        return;
+    }
+
+    runTask(pool, n, grain, 0, fn, ctx);
+}
+
+/**
+ * 静态划分的并行循环
+ *
+ * 把 [0, n) 平均切成 线程数 + 1 段，每个线程(含调用线程)恰好处理一段。
+ * 负载均衡不如 parallelFor，但 n 相同时同一个线程总是处理同一段区间，
+ * 适合与 parallelReserveMyList 配合，让每个线程访问的都是自己首次写入的页。
+ */
+void parallelForStatic(ThreadPool* pool, int n, RangeFunc fn, void* ctx)
+{
+    if (n <= 0)
+        return;
+    if (pool->numThreads == 0)
+    {
+        fn(ctx, 0, n);
+        return;
+    }
+
+    runTask(pool, n, 0, 1, fn, ctx);
+}
+
+
+/* ---------------- 并行排序 ---------------- */
+
+typedef struct
+{
+    int* src;    // 本轮的输入
+    int* dst;    // 本轮的输出
+    int n;
+    int runLen;  // 第一阶段每段的长度
+    int width;   // 本轮每个有序段的长度
+} SortCtx;
+
+static int cmpInt(const void* a, const void* b)
+{
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/* 第一阶段: 对第 [begin, end) 段分别排序 */
+static void sortRuns(void* p, int begin, int end)
+{
+    SortCtx* ctx = p;
+    for (int r = begin; r < end; r++)
+    {
+        long long lo = (long long)r * ctx->runLen;
+        long long hi = lo + ctx->runLen < ctx->n ? lo + ctx->runLen : ctx->n;
+        qsort(ctx->src + lo, (size_t)(hi - lo), sizeof(int), cmpInt);
+    }
+}
+
+/**
+ * 归并路径上的二分查找
+ *
+ * 返回有序数组 a(长 m) 和 b(长 nb) 归并结果的前 k 个元素中来自 a 的个数。
+ * 相等元素优先取 a，保证归并是稳定的。
+ */
+static int coRank(int k, const int* a, int m, const int* b, int nb)
+{
+    int lo = k > nb ? k - nb : 0;
+    int hi = k < m ? k : m;
+    while (lo < hi)
+    {
+        int i = lo + (hi - lo) / 2;
+        int j = k - i;
+        if (i < m && j > 0 && a[i] <= b[j - 1])
+            lo = i + 1; // 还需要从 a 中取更多元素
+        else
+            hi = i;
+    }
+
+    return lo;
+}
+
+/* 第二阶段: 计算输出区间 [begin, end) 的归并结果，区间可能跨越多对有序段 */
+static void mergeRange(void* p, int begin, int end)
+{
+    SortCtx* ctx = p;
+    long long w = ctx->width;
+    long long k = begin;
+
+    while (k < end)
+    {
+        long long lo = k / (2 * w) * (2 * w);
+        long long mid = lo + w < ctx->n ? lo + w : ctx->n;
+        long long hi = lo + 2 * w < ctx->n ? lo + 2 * w : ctx->n;
+        long long segEnd = end < hi ? end : hi;
+
+        const int* a = ctx->src + lo;
+        const int* b = ctx->src + mid;
+        int m = (int)(mid - lo), nb = (int)(hi - mid);
+        int i = coRank((int)(k - lo), a, m, b, nb);
+        int j = (int)(k - lo) - i;
+
+        for (int* out = ctx->dst + k; out < ctx->dst + segEnd; out++)
+        {
+            if (j >= nb || (i < m && a[i] <= b[j]))
+                *out = a[i++];
+            else
+                *out = b[j++];
+        }
+        k = segEnd;
+    }
+}
+
+/* 并行拷贝 src 到 dst */
+static void copyRange(void* p, int begin, int end)
+{
+    SortCtx* ctx = p;
+    memcpy(ctx->dst + begin, ctx->src + begin, sizeof(int) * (size_t)(end - begin));
+}
+
+/* 并行排序(升序) */
+void parallelSortMyList(ThreadPool* pool, MyList* list, int grain)
+{
+    int n = size(list);
+    if (grain <= 0)
+        grain = DEFAULT_GRAIN;
+    if (n <= 1)
+        return;
+
+    int* arr = toArray(list);
+    int* tmp = malloc(sizeof(int) * (size_t)n);
+    if (tmp == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+
+    // 第一阶段: 每个线程约负责一段，段长不小于 grain
+    int workers = pool->numThreads + 1;
+    int runLen = (int)(((long long)n + workers - 1) / workers);
+    if (runLen < grain)
+        runLen = grain;
+    int numRuns = (int)(((long long)n + runLen - 1) / runLen);
+
+    SortCtx ctx = {arr, tmp, n, runLen, runLen};
+    parallelFor(pool, numRuns, 1, sortRuns, &ctx);
+
+    // 第二阶段: 逐轮归并，输入输出交替使用 arr 和 tmp
+    for (long long width = runLen; width < n; width *= 2)
+    {
+        ctx.width = (int)width;
+        parallelFor(pool, n, grain, mergeRange, &ctx);
+        int* t = ctx.src;
+        ctx.src = ctx.dst;
+        ctx.dst = t;
+    }
+
+    // 结果在 tmp 中时拷贝回列表
+    if (ctx.src != arr)
+    {
+        ctx.dst = arr;
+        parallelFor(pool, n, grain, copyRange, &ctx);
+    }
+    free(tmp);
+}
+
+
+/* ---------------- 并行前缀和 ---------------- */
+
+typedef struct
+{
+    int* arr;
+    long long* blockSums; // 第一阶段: 每块的和; 第二阶段: 每块之前所有元素的和
+    int grain;
+    int inclusive;
+} ScanCtx;
+
+/* 第一阶段: 求每块的和 */
+static void sumBlock(void* p, int begin, int end)
+{
+    ScanCtx* ctx = p;
+    long long sum = 0;
+    for (int i = begin; i < end; i++)
+        sum += ctx->arr[i];
+    ctx->blockSums[begin / ctx->grain] = sum;
+}
+
+/* 第二阶段: 从块的偏移量开始重新扫描 */
+static void scanBlock(void* p, int begin, int end)
+{
+    ScanCtx* ctx = p;
+    long long running = ctx->blockSums[begin / ctx->grain];
+    for (int i = begin; i < end; i++)
+    {
+        long long val = ctx->arr[i];
+        if (ctx->inclusive)
+        {
+            running += val;
+            ctx->arr[i] = (int)running;
+        }
+        else
+        {
+            ctx->arr[i] = (int)running;
+            running += val;
+        }
+    }
+}
+
+/**
+ * 并行前缀和(原地)
+ *
+ * inclusive 为 1 时第 i 个元素变为前 i + 1 个元素之和，为 0 时变为前 i 个元素之和。
+ */
+void parallelScanMyList(ThreadPool* pool, MyList* list, int inclusive, int grain)
+{
+    int n = size(list);
+    if (grain <= 0)
+        grain = DEFAULT_GRAIN;
+    if (n <= 0)
+        return;
+
+    int numBlocks = (int)(((long long)n + grain - 1) / grain);
+    ScanCtx ctx = {toArray(list), malloc(sizeof(long long) * (size_t)numBlocks), grain, inclusive};
+
+    parallelFor(pool, n, grain, sumBlock, &ctx);
+
+    // 块数量很少，串行计算每块的偏移量
+    long long offset = 0;
+    for (int b = 0; b < numBlocks; b++)
+    {
+        long long sum = ctx.blockSums[b];
+        ctx.blockSums[b] = offset;
+        offset += sum;
+    }
+
+    parallelFor(pool, n, grain, scanBlock, &ctx);
+    free(ctx.blockSums);
+}
+
+
+/* ---------------- 并行映射 ---------------- */
+
+typedef struct
+{
+    int* arr;
+    int (*fn)(int);
+} MapCtx;
+
+static void mapBlock(void* p, int begin, int end)
+{
+    MapCtx* ctx = p;
+    for (int i = begin; i < end; i++)
+        ctx->arr[i] = ctx->fn(ctx->arr[i]);
+}
+
+/* 并行映射(原地): 每个元素替换为 fn(元素) */
+void parallelMapMyList(ThreadPool* pool, MyList* list, int (*fn)(int), int grain)
+{
+    MapCtx ctx = {toArray(list), fn};
+    parallelFor(pool, size(list), grain, mapBlock, &ctx);
+}
+
+
+/* ---------------- 并行预留容量 ---------------- */
+
+typedef struct
+{
+    int* arr;
+    int start; // 新增容量的起点
+} TouchCtx;
+
+static void touchBlock(void* p, int begin, int end)
+{
+    TouchCtx* ctx = p;
+    touchPages(ctx->arr + ctx->start + begin, sizeof(int) * (size_t)(end - begin));
+}
+
+/**
+ * 并行预留容量
+ *
+ * 把容量扩大到不小于 minCapacity，再用 parallelForStatic 把新增的容量 [size, capacity) 分给各线程首次写入:
+ * 缺页处理由所有线程分担，物理页分配在之后处理该区间的线程所在的 NUMA 节点上。
+ * 之后对 [size, capacity) 区间调用 parallelForStatic(n = capacity - size) 时，每个线程访问的都是本地内存。
+ */
+void parallelReserveMyList(ThreadPool* pool, MyList* list, int minCapacity)
+{
+    if (minCapacity <= capacity(list))
+        return;
+
+    resizeCapacity(list, minCapacity);
+    TouchCtx ctx = {toArray(list), size(list)};
+    parallelForStatic(pool, capacity(list) - size(list), touchBlock, &ctx);
+}
+
+
+/* 示例映射函数 */
+static int square(int x)
+{
+    return x * x;
+}
+
+/* 当前时间(秒) */
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(void)
+{
+    ThreadPool* pool = newThreadPool(0);
+    printf("Workers: %d (+ caller)\n\n", pool->numThreads);
+
+    /**
+     * 小列表示例
+     */
+    MyList* list = newMyList();
+    int vals[8] = {5, 3, 8, 1, 9, 2, 7, 4};
+    pushElements(list, vals, 8);
+    parallelSortMyList(pool, list, 2);
+    arrPrint(toArray(list), size(list)); // [1, 2, 3, 4, 5, 7, 8, 9]
+    parallelMapMyList(pool, list, square, 2);
+    arrPrint(toArray(list), size(list)); // [1, 4, 9, 16, 25, 49, 64, 81]
+    parallelScanMyList(pool, list, 1, 2);
+    arrPrint(toArray(list), size(list)); // [1, 5, 14, 30, 55, 104, 168, 249]
+    parallelScanMyList(pool, list, 0, 2);
+    arrPrint(toArray(list), size(list)); // [0, 1, 6, 20, 50, 105, 209, 377]
+    destoryMyList(list);
+
+    /**
+     * 大列表: 与单线程 qsort 对比
+     */
+    int n = 20000000;
+    MyList* big = newMyList();
+    MyList* copy = newMyList();
+    srand(1);
+    for (int i = 0; i < n; i++)
+    {
+        pushElement(big, rand());
+    }
+    pushElements(copy, toArray(big), n);
+
+    double start = now();
+    qsort(toArray(copy), n, sizeof(int), cmpInt);
+    printf("\nqsort:        %.3fs\n", now() - start);
+
+    start = now();
+    parallelSortMyList(pool, big, 0);
+    printf("parallel sort: %.3fs, same result: %d\n", now() - start,
+           memcmp(toArray(big), toArray(copy), sizeof(int) * n) == 0); // 1
+
+    /**
+     * 并行预留容量: 由各线程首次写入新分配的页，追加元素时不再触发缺页
+     */
+    MyList* serial = newMyList();
+    start = now();
+    resizeCapacity(serial, n);
+    pushElements(serial, readArray(copy), n);
+    printf("\nreserve + push:          %.3fs\n", now() - start);
+
+    MyList* touched = newMyList();
+    start = now();
+    parallelReserveMyList(pool, touched, n);
+    double reserveTime = now() - start;
+    start = now();
+    pushElements(touched, readArray(copy), n);
+    printf("parallel reserve + push: %.3fs (reserve %.3fs), same result: %d\n",
+           reserveTime + now() - start, reserveTime,
+           memcmp(readArray(serial), readArray(touched), sizeof(int) * n) == 0); // 1
+
+    destoryMyList(serial);
+    destoryMyList(touched);
+    destoryMyList(big);
+    destoryMyList(copy);
+    destroyThreadPool(pool);
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#ifndef PARALLEL_LIST_H
+#define PARALLEL_LIST_H
+
+#include <pthread.h>
+#include "list.h"
+
+/* 每个任务块默认处理的元素个数 */
+#define DEFAULT_GRAIN 16384
+
+/* 并行循环的任务函数: 处理区间 [begin, end) */
+typedef void (*RangeFunc)(void* ctx, int begin, int end);
+
+/**
+ * 线程池
+ *
+ * 工作线程在创建后常驻，每次 parallelFor 把区间 [0, n) 按 grain 切块，
+ * 所有工作线程和调用线程一起通过原子计数器领取任务块。
+ * parallelForStatic 则把 [0, n) 平均分给各线程，n 相同时每个线程总是处理同一段区间。
+ */
+typedef struct
+{
+    pthread_t* threads;     // 工作线程
+    int numThreads;         // 工作线程数量(不含调用线程)
+    pthread_mutex_t lock;
+    pthread_cond_t start;   // 通知工作线程有新任务
+    pthread_cond_t done;    // 通知调用线程任务完成
+    int generation;         // 任务编号，每次 parallelFor 加 1
+    int active;             // 仍在执行当前任务的工作线程数量
+    int stop;               // 是否销毁线程池
+    int nextWorkerId;       // 工作线程启动时领取编号(原子访问)
+
+    // 当前任务
+    RangeFunc fn;
+    void* ctx;
+    int n;
+    int grain;
+    long long next;         // 下一个待领取任务块的起点(原子访问)
+    int staticSchedule;     // 是否按线程编号静态划分区间
+} ThreadPool;
+
+
+ThreadPool* newThreadPool(int numThreads);
+void destroyThreadPool(ThreadPool* pool);
+void parallelFor(ThreadPool* pool, int n, int grain, RangeFunc fn, void* ctx);
+void parallelForStatic(ThreadPool* pool, int n, RangeFunc fn, void* ctx);
+void parallelReserveMyList(ThreadPool* pool, MyList* list, int minCapacity);
+void parallelSortMyList(ThreadPool* pool, MyList* list, int grain);
+void parallelScanMyList(ThreadPool* pool, MyList* list, int inclusive, int grain);
+void parallelMapMyList(ThreadPool* pool, MyList* list, int (*fn)(int), int grain);
+
+#endif
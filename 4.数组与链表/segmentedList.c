@@ -0,0 +1,214 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "segmentedList.h"
+
+/**
+ * 分段数组列表
+ *
+ * MyList 每次扩容都要把整个数组拷贝到新内存，指向元素的指针也随之失效。
+ * 分段数组把元素存放在大小依次翻倍的段中:
+ *   第 0 段: [0, B)，第 1 段: [B, 3B)，第 2 段: [3B, 7B) ...  (B = SEG_BASE)
+ * 1. 扩容: 只需分配下一段，已有元素不拷贝，地址保持不变。
+ * 2. 访问: 第 k 段覆盖 index + B 的区间 [B * 2^k, B * 2^(k+1))，
+ *    因此段号由 index + B 的最高位决定，只需一次位扫描(__builtin_clz)，时间复杂度 O(1)。
+ * 3. 空间: 段的大小依次翻倍，空闲空间不超过已用空间，与 MyList 的倍增扩容相同。
+ */
+
+/* 第 k 段的起始索引 */
+static inline int segStart(int k)
+{
+    return SEG_BASE * ((1 << k) - 1);
+}
+
+/* 第 k 段的元素个数 */
+static inline int segLen(int k)
+{
+    return SEG_BASE << k;
+}
+
+/* 把索引 index 定位到第 k 段的第 offset 个位置 */
+static inline void locate(int index, int* k, int* offset)
+{
+    unsigned v = (unsigned)index + SEG_BASE;
+    int msb = 31 - __builtin_clz(v);  // 最高位的位置
+    *k = msb - SEG_BASE_SHIFT;
+    *offset = (int)(v ^ (1u << msb)); // 去掉最高位即为段内偏移
+}
+
+/* 追加一个新段 */
+static void addSegment(SegmentedList* list)
+{
+    if (list->numSegs == SEG_MAX) {
+        fprintf(stderr, "SegmentedList is full!\n");
+        exit(1);
+    }
+    int* seg = malloc(sizeof(int) * (size_t)segLen(list->numSegs));
+    if (seg == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    list->segs[list->numSegs++] = seg;
+}
+
+
+/* 构造函数 */
+SegmentedList* newSegmentedList()
+{
+    SegmentedList* list = malloc(sizeof(SegmentedList));
+    list->numSegs = 0;
+    list->size = 0;
+    addSegment(list);
+
+    return list;
+}
+
+/* 析构函数 */
+void destroySegmentedList(SegmentedList* list)
+{
+    if (list != NULL)
+    {
+        for (int k = 0; k < list->numSegs; k++)
+            free(list->segs[k]);
+        free(list);
+    }
+}
+
+/* 获取列表长度 */
+int sizeSegmentedList(SegmentedList* list)
+{
+    return list->size;
+}
+
+/* 获取列表容量 */
+int capacitySegmentedList(SegmentedList* list)
+{
+    return segStart(list->numSegs);
+}
+
+/**
+ * 获取元素的地址
+ *
+ * 只要元素没有因为插入或删除而改变索引，这个地址在扩容后依然有效。
+ */
+int* addrSegmentedList(SegmentedList* list, int index)
+{
+    if (index < 0 || index >= list->size)
+        return NULL;
+
+    int k, offset;
+    locate(index, &k, &offset);
+
+    return &list->segs[k][offset];
+}
+
+/* 访问元素 */
+int getSegmentedList(SegmentedList* list, int index)
+{
+    int* p = addrSegmentedList(list, index);
+
+    return p != NULL ? *p : -1;
+}
+
+/* 更新元素 */
+int setSegmentedList(SegmentedList* list, int index, int val)
+{
+    int* p = addrSegmentedList(list, index);
+    if (p == NULL)
+        return -1;
+
+    *p = val;
+    return 0;
+}
+
+/* 在列表尾部追加元素 */
+void pushSegmentedList(SegmentedList* list, int val)
+{
+    if (list->size == capacitySegmentedList(list))
+        addSegment(list); // 扩容: 只分配新段，不拷贝
+
+    int k, offset;
+    locate(list->size, &k, &offset);
+    list->segs[k][offset] = val;
+    list->size++;
+}
+
+/**
+ * 在列表中插入元素
+ *
+ * 从最后一段开始逐段向后移动一位，每段用一次 memmove，
+ * 前一段的末尾元素移入后一段的开头。
+ */
+void insertSegmentedList(SegmentedList* list, int index, int val)
+{
+    if (index < 0 || index > list->size)
+        exit(1);
+
+    if (list->size == capacitySegmentedList(list))
+        addSegment(list);
+
+    int kStart, kEnd, offset;
+    locate(index, &kStart, &offset);
+    locate(list->size, &kEnd, &offset);
+
+    for (int k = kEnd; k >= kStart; k--)
+    {
+        int* seg = list->segs[k];
+        int lo = (k == kStart) ? index - segStart(k) : 0;
+        int hi = (k == kEnd) ? list->size - segStart(k) : segLen(k) - 1;
+        memmove(seg + lo + 1, seg + lo, sizeof(int) * (size_t)(hi - lo));
+        if (k > kStart)
+            seg[0] = list->segs[k - 1][segLen(k - 1) - 1];
+    }
+
+    int k;
+    locate(index, &k, &offset);
+    list->segs[k][offset] = val;
+    list->size++;
+}
+
+/* 删除元素 */
+int delSegmentedList(SegmentedList* list, int index)
+{
+    if (index < 0 || index >= list->size)
+        return -1;
+
+    int kStart, kEnd, offset;
+    locate(index, &kStart, &offset);
+    locate(list->size - 1, &kEnd, &offset);
+    int num = *addrSegmentedList(list, index);
+
+    for (int k = kStart; k <= kEnd; k++)
+    {
+        int* seg = list->segs[k];
+        int lo = (k == kStart) ? index - segStart(k) : 0;
+        int hi = (k == kEnd) ? list->size - 1 - segStart(k) : segLen(k) - 1;
+        memmove(seg + lo, seg + lo + 1, sizeof(int) * (size_t)(hi - lo));
+        if (k < kEnd)
+            seg[segLen(k) - 1] = list->segs[k + 1][0];
+    }
+    list->size--;
+
+    // 最后两段都空了才释放最后一段，避免在段边界反复分配、释放
+    if (list->numSegs > 1 && list->size <= segStart(list->numSegs - 2))
+    {
+        list->numSegs--;
+        free(list->segs[list->numSegs]);
+    }
+
+    return num;
+}
+
+/* 将列表按顺序拷贝到数组 res 中(res 至少能容纳 size 个元素) */
+int* toArraySegmentedList(SegmentedList* list, int* res)
+{
+    int copied = 0;
+    for (int k = 0; copied < list->size; k++)
+    {
+        int len = segLen(k) < list->size - copied ? segLen(k) : list->size - copied;
+        memcpy(res + copied, list->segs[k], sizeof(int) * (size_t)len);
+        copied += len;
+    }
+
+    return res;
+}
@@ -0,0 +1,36 @@
+#ifndef SEGMENTED_LIST_H
+#define SEGMENTED_LIST_H
+
+/* 第 0 段的元素个数(2 的幂)，之后每段翻倍 */
+#define SEG_BASE_SHIFT 3
+#define SEG_BASE (1 << SEG_BASE_SHIFT)
+/* 段数上限: 总容量 SEG_BASE * (2^SEG_MAX - 1) = 2^31 - SEG_BASE，不超过 INT_MAX */
+#define SEG_MAX (31 - SEG_BASE_SHIFT)
+
+/**
+ * 分段数组列表
+ *
+ * 第 k 段容纳 SEG_BASE * 2^k 个元素，扩容时只分配新段，已有元素从不移动。
+ * 包含: 段指针数组，已分配的段数，列表大小
+ */
+typedef struct
+{
+    int* segs[SEG_MAX];  // 段指针数组
+    int numSegs;         // 已分配的段数
+    int size;            // 列表中的元素数量
+} SegmentedList;
+
+
+SegmentedList* newSegmentedList();
+void destroySegmentedList(SegmentedList* list);
+int sizeSegmentedList(SegmentedList* list);
+int capacitySegmentedList(SegmentedList* list);
+int* addrSegmentedList(SegmentedList* list, int index);
+int getSegmentedList(SegmentedList* list, int index);
+int setSegmentedList(SegmentedList* list, int index, int val);
+void pushSegmentedList(SegmentedList* list, int val);
+void insertSegmentedList(SegmentedList* list, int index, int val);
+int delSegmentedList(SegmentedList* list, int index);
+int* toArraySegmentedList(SegmentedList* list, int* res);
+
+#endif
@@ -0,0 +1,42 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "segmentedList.h"
+#include "array.h"
+
+/* 编译命令: gcc -O2 segmentedListTest.c segmentedList.c array.c -o segmentedListTest */
+
+
+int main(void)
+{
+    /**
+     * 分段数组列表测试
+     */
+    SegmentedList* list = newSegmentedList();
+    for (int i = 0; i < 10; i++)
+    {
+        pushSegmentedList(list, i);
+    }
+    insertSegmentedList(list, 2, 100); // 跨越第 0 段和第 1 段
+    delSegmentedList(list, 0);
+    setSegmentedList(list, 0, 99);
+    int res[10];
+    arrPrint(toArraySegmentedList(list, res), sizeSegmentedList(list)); // [99, 100, 2, 3, 4, 5, 6, 7, 8, 9]
+
+    /**
+     * 地址稳定性: 扩容后指向元素的指针仍然有效
+     */
+    int* first = addrSegmentedList(list, 0);
+    clock_t start = clock();
+    for (int i = 0; i < 10000000; i++)
+    {
+        pushSegmentedList(list, i);
+    }
+    printf("Size: %d, capacity: %d, %.3fs\n", sizeSegmentedList(list), capacitySegmentedList(list),
+           (double)(clock() - start) / CLOCKS_PER_SEC);
+    printf("Pointer still valid: %d\n", first == addrSegmentedList(list, 0) && *first == 99); // 1
+
+    destroySegmentedList(list);
+
+    return 0;
+}
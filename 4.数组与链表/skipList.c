@@ -0,0 +1,394 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "skipList.h"
+
+/* 编译命令: gcc -O2 skipList.c -o skipList */
+
+/**
+ * 跳表(skip list)
+ *
+ * linkedList.c 中的 accessNode 和 findNode 都要从头节点逐个向后遍历，时间复杂度为 O(n)。
+ * 跳表在有序链表之上建立多层“快速通道”: 第 0 层包含全部节点，每个节点以 1/4 的概率出现在更高一层。
+ * 查找时从最高层开始，能向前跳就向前跳，跳不动时下降一层，期望时间复杂度为 O(log n)。
+ *
+ * 每个前向指针还记录它跨过的元素个数(width)。沿查找路径累加 width 就得到节点的索引，
+ * 因此按值查找和按位置访问都是 O(log n)。插入、删除时只需修改查找路径上各层指针的 width。
+ */
+
+
+/* 创建塔高为 level 的节点 */
+static SkipNode* newSkipNode(int val, int level)
+{
+    SkipNode* node = (SkipNode*)malloc(sizeof(SkipNode) + sizeof(SkipLink) * (size_t)level);
+    if (node == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    node->val = val;
+    node->level = level;
+    for (int i = 0; i < level; i++)
+    {
+        node->links[i].next = NULL;
+        node->links[i].width = 0;
+    }
+
+    return node;
+}
+
+
+/* 构造函数 */
+SkipList* newSkipList()
+{
+    SkipList* list = (SkipList*)malloc(sizeof(SkipList));
+    if (list == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    list->head = newSkipNode(0, SKIP_MAX_LEVEL);
+    list->level = 1;
+    list->size = 0;
+    list->seed = 2463534242u;
+
+    return list;
+}
+
+
+/* 析构函数 */
+void destroySkipList(SkipList* list)
+{
+    if (list != NULL)
+    {
+        SkipNode* node = list->head;
+        while (node)
+        {
+            SkipNode* next = node->links[0].next;
+            free(node);
+            node = next;
+        }
+        free(list);
+    }
+}
+
+
+/* 获取元素数量 */
+int sizeSkipList(SkipList* list)
+{
+    return list->size;
+}
+
+
+/* 随机塔高: 每升高一层的概率为 1/4 */
+static int randomLevel(SkipList* list)
+{
+    uint32_t x = list->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    list->seed = x;
+
+    int level = 1;
+    while ((x & 3) == 0 && level < SKIP_MAX_LEVEL)
+    {
+        level++;
+        x >>= 2;
+    }
+
+    return level;
+}
+
+
+/**
+ * 插入元素，返回插入位置的索引
+ *
+ * 与 target 相等的元素已存在时，插入到它们之后。
+ * update[i] 为第 i 层中新节点的前驱，rank[i] 为 update[i] 之前(含)的元素个数。
+ */
+int insertSkipList(SkipList* list, int val)
+{
+    SkipNode* update[SKIP_MAX_LEVEL];
+    int rank[SKIP_MAX_LEVEL];
+
+    SkipNode* x = list->head;
+    for (int i = list->level - 1; i >= 0; i--)
+    {
+        rank[i] = i == list->level - 1 ? 0 : rank[i + 1];
+        while (x->links[i].next != NULL && x->links[i].next->val <= val)
+        {
+            rank[i] += x->links[i].width;
+            x = x->links[i].next;
+        }
+        update[i] = x;
+    }
+
+    int level = randomLevel(list);
+    if (level > list->level)
+    {
+        // 新增的层: 头节点直接指向新节点
+        for (int i = list->level; i < level; i++)
+        {
+            rank[i] = 0;
+            update[i] = list->head;
+            update[i]->links[i].width = list->size;
+        }
+        list->level = level;
+    }
+
+    SkipNode* node = newSkipNode(val, level);
+    for (int i = 0; i < level; i++)
+    {
+        node->links[i].next = update[i]->links[i].next;
+        update[i]->links[i].next = node;
+        // 前驱原来跨过的元素，一部分改由新节点跨过
+        node->links[i].width = update[i]->links[i].width - (rank[0] - rank[i]);
+        update[i]->links[i].width = rank[0] - rank[i] + 1;
+    }
+    // 更高的层跨过了新节点，宽度加 1
+    for (int i = level; i < list->level; i++)
+        update[i]->links[i].width++;
+    list->size++;
+
+    return rank[0];
+}
+
+
+/* 从跳表中摘除节点 x，update[i] 为第 i 层中 x 的前驱 */
+static void unlinkSkipNode(SkipList* list, SkipNode* x, SkipNode** update)
+{
+    for (int i = 0; i < list->level; i++)
+    {
+        if (update[i]->links[i].next == x)
+        {
+            update[i]->links[i].width += x->links[i].width - 1;
+            update[i]->links[i].next = x->links[i].next;
+        }
+        else
+        {
+            update[i]->links[i].width--;
+        }
+    }
+    while (list->level > 1 && list->head->links[list->level - 1].next == NULL)
+        list->level--;
+    list->size--;
+    free(x);
+}
+
+
+/* 删除一个值为 val 的元素，成功返回 0，不存在返回 -1 */
+int deleteSkipList(SkipList* list, int val)
+{
+    SkipNode* update[SKIP_MAX_LEVEL];
+    SkipNode* x = list->head;
+    for (int i = list->level - 1; i >= 0; i--)
+    {
+        while (x->links[i].next != NULL && x->links[i].next->val < val)
+            x = x->links[i].next;
+        update[i] = x;
+    }
+
+    x = x->links[0].next;
+    if (x == NULL || x->val != val)
+        return -1;
+    unlinkSkipNode(list, x, update);
+
+    return 0;
+}
+
+
+/* 删除索引为 index 的元素，返回被删除的元素，越界返回 -1 */
+int deleteAtSkipList(SkipList* list, int index)
+{
+    if (index < 0 || index >= list->size)
+        return -1;
+
+    // 停在第 index 个元素(从 1 计数为 index + 1)的前驱上
+    SkipNode* update[SKIP_MAX_LEVEL];
+    SkipNode* x = list->head;
+    int traversed = 0;
+    for (int i = list->level - 1; i >= 0; i--)
+    {
+        while (x->links[i].next != NULL && traversed + x->links[i].width <= index)
+        {
+            traversed += x->links[i].width;
+            x = x->links[i].next;
+        }
+        update[i] = x;
+    }
+
+    x = x->links[0].next;
+    int val = x->val;
+    unlinkSkipNode(list, x, update);
+
+    return val;
+}
+
+
+/**
+ * 统计小于 target 的元素个数(inclusive 非 0 时统计不大于 target 的)
+ *
+ * 沿查找路径累加 width，*last 为最后一个满足条件的节点(没有时为头节点)。
+ */
+static int countBelow(SkipList* list, int target, int inclusive, SkipNode** last)
+{
+    SkipNode* x = list->head;
+    int traversed = 0;
+    for (int i = list->level - 1; i >= 0; i--)
+    {
+        while (x->links[i].next != NULL &&
+               (x->links[i].next->val < target || (inclusive && x->links[i].next->val == target)))
+        {
+            traversed += x->links[i].width;
+            x = x->links[i].next;
+        }
+    }
+    *last = x;
+
+    return traversed;
+}
+
+
+/* 第一个不小于 target 的元素的索引，所有元素都小于 target 时返回 size */
+int lowerBoundSkipList(SkipList* list, int target)
+{
+    SkipNode* x;
+    return countBelow(list, target, 0, &x);
+}
+
+
+/* 查找元素，返回第一个等于 target 的元素的索引，未找到返回 -1 */
+int findSkipList(SkipList* list, int target)
+{
+    SkipNode* x;
+    int index = countBelow(list, target, 0, &x);
+
+    x = x->links[0].next;
+    return x != NULL && x->val == target ? index : -1;
+}
+
+
+/* 访问索引为 index 的节点，越界返回 NULL */
+SkipNode* accessSkipList(SkipList* list, int index)
+{
+    if (index < 0 || index >= list->size)
+        return NULL;
+
+    // 沿 width 前进，直到恰好跨过 index + 1 个元素
+    SkipNode* x = list->head;
+    int traversed = 0;
+    for (int i = list->level - 1; i >= 0; i--)
+    {
+        while (x->links[i].next != NULL && traversed + x->links[i].width <= index + 1)
+        {
+            traversed += x->links[i].width;
+            x = x->links[i].next;
+        }
+        if (traversed == index + 1)
+            return x;
+    }
+
+    return NULL;
+}
+
+
+/* 按位置的区间 [from, to) */
+void initIndexRange(SkipIter* it, SkipList* list, int from, int to)
+{
+    if (from < 0)
+        from = 0;
+    if (to > list->size)
+        to = list->size;
+    it->node = from < to ? accessSkipList(list, from) : NULL;
+    it->remaining = from < to ? to - from : 0;
+}
+
+
+/* 按值的区间 [lo, hi] */
+void initValueRange(SkipIter* it, SkipList* list, int lo, int hi)
+{
+    SkipNode* x;
+    int from = countBelow(list, lo, 0, &x);
+    it->node = x->links[0].next;
+    // 区间内的元素个数 = 不大于 hi 的元素个数 - 小于 lo 的元素个数
+    int to = lo <= hi ? countBelow(list, hi, 1, &x) : from;
+    it->remaining = to - from;
+}
+
+
+/* 取出下一个元素，遍历结束时返回 0 */
+int nextSkipIter(SkipIter* it, int* val)
+{
+    if (it->remaining == 0 || it->node == NULL)
+        return 0;
+
+    *val = it->node->val;
+    it->node = it->node->links[0].next;
+    it->remaining--;
+
+    return 1;
+}
+
+
+int main(void)
+{
+    /**
+     * 基本操作
+     */
+    SkipList* list = newSkipList();
+    int vals[8] = {30, 10, 50, 20, 40, 20, 60, 0};
+    for (int i = 0; i < 8; i++)
+        insertSkipList(list, vals[i]); // 0 10 20 20 30 40 50 60
+
+    printf("Index of 30: %d\n", findSkipList(list, 30));        // 4
+    printf("Index of 25: %d\n", findSkipList(list, 25));        // -1
+    printf("Element 6: %d\n", accessSkipList(list, 6)->val);    // 50
+
+    int val;
+    SkipIter it;
+    initValueRange(&it, list, 15, 45);
+    while (nextSkipIter(&it, &val))
+        printf("%d ", val); // 20 20 30 40
+    printf("\n");
+
+    deleteSkipList(list, 20);
+    deleteAtSkipList(list, 0);
+    initIndexRange(&it, list, 0, sizeSkipList(list));
+    while (nextSkipIter(&it, &val))
+        printf("%d ", val); // 10 20 30 40 50 60
+    printf("\n");
+    destroySkipList(list);
+
+    /**
+     * 有序事件日志: 按时间戳查找与按位置访问
+     */
+    int n = 1000000, m = 1000000;
+    list = newSkipList();
+    srand(1);
+    clock_t start = clock();
+    for (int i = 0; i < n; i++)
+        insertSkipList(list, rand() % (10 * n));
+    printf("Insert %d: %.3fs\n", n, (double)(clock() - start) / CLOCKS_PER_SEC);
+
+    // 位置访问与按值查找互相校验
+    int ok = 1;
+    start = clock();
+    for (int i = 0; i < m; i++)
+    {
+        int index = rand() % n;
+        int ts = accessSkipList(list, index)->val;
+        int first = findSkipList(list, ts);
+        ok &= first <= index && accessSkipList(list, first)->val == ts;
+    }
+    printf("%d access + find: %.3fs, correct: %d\n", m, (double)(clock() - start) / CLOCKS_PER_SEC, ok); // 1
+
+    // 时间窗口内的事件数
+    initValueRange(&it, list, 1000, 2000);
+    int count = 0;
+    while (nextSkipIter(&it, &val))
+        count++;
+    printf("Events in [1000, 2000]: %d\n", count);
+
+    destroySkipList(list);
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <stdint.h>
+
+/* 最大层数，每层的节点数约为下一层的 1/4，16 层足以容纳 2^32 个元素 */
+#define SKIP_MAX_LEVEL 16
+
+/* 一层的前向指针，width 为从当前节点沿该指针前进时跨过的元素个数 */
+typedef struct SkipLink
+{
+    struct SkipNode* next;
+    int width;
+} SkipLink;
+
+/**
+ * 跳表节点
+ *
+ * 节点所在的层数(塔高)在插入时随机决定，links[i] 为第 i 层的前向指针。
+ */
+typedef struct SkipNode
+{
+    int val;
+    int level;          // 塔高
+    SkipLink links[];   // 共 level 个
+} SkipNode;
+
+/**
+ * 跳表
+ *
+ * 包含: 头节点(不存放元素，塔高为 SKIP_MAX_LEVEL)，当前最高层数，元素数量，随机数状态
+ */
+typedef struct
+{
+    SkipNode* head;
+    int level;
+    int size;
+    uint32_t seed;
+} SkipList;
+
+/* 区间迭代器: 从 node 开始顺序取出 remaining 个元素 */
+typedef struct
+{
+    SkipNode* node;
+    int remaining;
+} SkipIter;
+
+
+SkipList* newSkipList();
+void destroySkipList(SkipList* list);
+int sizeSkipList(SkipList* list);
+int insertSkipList(SkipList* list, int val);
+int deleteSkipList(SkipList* list, int val);
+int deleteAtSkipList(SkipList* list, int index);
+int lowerBoundSkipList(SkipList* list, int target);
+int findSkipList(SkipList* list, int target);
+SkipNode* accessSkipList(SkipList* list, int index);
+void initIndexRange(SkipIter* it, SkipList* list, int from, int to);
+void initValueRange(SkipIter* it, SkipList* list, int lo, int hi);
+int nextSkipIter(SkipIter* it, int* val);
+
+#endif
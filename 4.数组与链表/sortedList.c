@@ -0,0 +1,245 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sortedList.h"
+#include "sortedSearch.h"
+
+/* 编译命令: gcc -O2 sortedList.c sortedSearch.c list.c -o sortedList */
+
+/**
+ * 基数排序与有序列表
+ *
+ * 基于比较的排序(如 qsort)时间复杂度为 O(n log n)，且每次比较都要调用比较函数。
+ * LSD 基数排序按字节从低到高对 32 位整数做 4 轮计数排序，时间复杂度为 O(4n)，不需要比较:
+ * 1. 统计: 一次遍历同时统计 4 个字节各自的直方图;
+ * 2. 分配: 每轮按当前字节把元素稳定地分配到临时数组，然后交换输入和输出;
+ * 3. 有符号整数: 最高字节的符号位取反后再统计，负数就会排在正数之前;
+ * 4. 某个字节在所有元素中都相同时，这一轮可以直接跳过。
+ *
+ * 在有序列表上还提供: 二分查找插入位置、原地去重、两个有序列表的归并。
+ */
+
+/* 构造函数 */
+RadixScratch* newRadixScratch()
+{
+    RadixScratch* scratch = malloc(sizeof(RadixScratch));
+    scratch->buf = NULL;
+    scratch->capacity = 0;
+
+    return scratch;
+}
+
+/* 析构函数 */
+void destroyRadixScratch(RadixScratch* scratch)
+{
+    if (scratch != NULL)
+    {
+        free(scratch->buf);
+        free(scratch);
+    }
+}
+
+/* 取元素的第 b 个字节，最高字节的符号位取反 */
+static inline unsigned radixKey(int val, int b)
+{
+    unsigned key = (unsigned)val ^ 0x80000000u;
+    return (key >> (8 * b)) & 0xFF;
+}
+
+/* LSD 基数排序(升序)，scratch 为 NULL 时临时分配缓冲区 */
+void radixSort(int* arr, int size, RadixScratch* scratch)
+{
+    if (size <= 1)
+        return;
+
+    RadixScratch local = {NULL, 0};
+    if (scratch == NULL)
+        scratch = &local;
+    if (scratch->capacity < size)
+    {
+        free(scratch->buf);
+        scratch->buf = malloc(sizeof(int) * (size_t)size);
+        if (scratch->buf == NULL) {
+            fprintf(stderr, "Memory allocation failed!\n");
+            exit(1);
+        }
+        scratch->capacity = size;
+    }
+
+    // 一次遍历统计 4 个字节的直方图
+    int count[4][256];
+    memset(count, 0, sizeof(count));
+    for (int i = 0; i < size; i++)
+    {
+        for (int b = 0; b < 4; b++)
+            count[b][radixKey(arr[i], b)]++;
+    }
+
+    int* src = arr;
+    int* dst = scratch->buf;
+    for (int b = 0; b < 4; b++)
+    {
+        // 所有元素的这个字节都相同，跳过这一轮
+        if (count[b][radixKey(src[0], b)] == size)
+            continue;
+
+        // 计数转换为每个桶的起始位置
+        int offset = 0;
+        for (int d = 0; d < 256; d++)
+        {
+            int c = count[b][d];
+            count[b][d] = offset;
+            offset += c;
+        }
+
+        for (int i = 0; i < size; i++)
+            dst[count[b][radixKey(src[i], b)]++] = src[i];
+
+        int* t = src;
+        src = dst;
+        dst = t;
+    }
+
+    // 执行的轮数为奇数时结果在缓冲区中
+    if (src != arr)
+        memcpy(arr, src, sizeof(int) * (size_t)size);
+
+    free(local.buf);
+}
+
+/* 对列表做基数排序 */
+void radixSortMyList(MyList* list, RadixScratch* scratch)
+{
+    radixSort(toArray(list), size(list), scratch);
+}
+
+/**
+ * 二分查找插入位置
+ *
+ * 返回有序列表中第一个不小于 target 的元素的索引，所有元素都小于 target 时返回 size。
+ * 使用 sortedSearch.c 中无分支、带预取的 lowerBoundArr。
+ */
+int lowerBound(MyList* list, int target)
+{
+    return lowerBoundArr(readArray(list), size(list), target);
+}
+
+
+/* 在有序列表中插入元素并保持有序，返回插入的位置 */
+int insertSorted(MyList* list, int val)
+{
+    int index = lowerBound(list, val);
+    insertRange(list, index, &val, 1);
+
+    return index;
+}
+
+/* 有序列表原地去重，返回去重后的元素数量 */
+int dedupSorted(MyList* list)
+{
+    int* arr = toArray(list);
+    int n = size(list);
+    if (n <= 1)
+        return n;
+
+    int k = 1; // [0, k) 为去重后的结果
+    for (int i = 1; i < n; i++)
+    {
+        if (arr[i] != arr[k - 1])
+            arr[k++] = arr[i];
+    }
+    deleteRange(list, k, n - k);
+
+    return k;
+}
+
+/* 归并两个有序列表，返回新的有序列表 */
+MyList* mergeSorted(MyList* a, MyList* b)
+{
+    const int* x = readArray(a);
+    const int* y = readArray(b);
+    int m = size(a), n = size(b);
+
+    MyList* res = newMyList();
+    resizeCapacity(res, m + n > MYLIST_INLINE_SIZE ? m + n : MYLIST_INLINE_SIZE);
+    int* out = toArray(res);
+
+    int i = 0, j = 0, k = 0;
+    while (i < m && j < n)
+        out[k++] = (y[j] < x[i]) ? y[j++] : x[i++];
+    memcpy(out + k, x + i, sizeof(int) * (size_t)(m - i));
+    k += m - i;
+    memcpy(out + k, y + j, sizeof(int) * (size_t)(n - j));
+    setSize(res, m + n);
+
+    return res;
+}
+
+
+static int cmpInt(const void* a, const void* b)
+{
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+int main(void)
+{
+    RadixScratch* scratch = newRadixScratch();
+
+    /**
+     * 基数排序示例(含负数)
+     */
+    MyList* list = newMyList();
+    int vals[10] = {5, -3, 8, 1, -9, 2, 8, -3, 0, 5};
+    pushElements(list, vals, 10);
+    radixSortMyList(list, scratch);
+    arrPrint(toArray(list), size(list)); // [-9, -3, -3, 0, 1, 2, 5, 5, 8, 8]
+
+    /**
+     * 有序列表操作
+     */
+    printf("Lower bound of 4: %d\n", lowerBound(list, 4)); // 6
+    insertSorted(list, 4);
+    dedupSorted(list);
+    arrPrint(toArray(list), size(list)); // [-9, -3, 0, 1, 2, 4, 5, 8]
+
+    MyList* other = newMyList();
+    int vals2[4] = {-5, 3, 4, 10};
+    pushElements(other, vals2, 4);
+    MyList* merged = mergeSorted(list, other);
+    arrPrint(toArray(merged), size(merged)); // [-9, -5, -3, 0, 1, 2, 3, 4, 4, 5, 8, 10]
+    destoryMyList(list);
+    destoryMyList(other);
+    destoryMyList(merged);
+
+    /**
+     * 与 qsort 对比
+     */
+    int n = 10000000;
+    MyList* a = newMyList();
+    MyList* b = newMyList();
+    srand(1);
+    for (int i = 0; i < n; i++)
+    {
+        pushElement(a, rand() - RAND_MAX / 2);
+    }
+    pushElements(b, toArray(a), n);
+
+    clock_t start = clock();
+    qsort(toArray(b), n, sizeof(int), cmpInt);
+    double qsortTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    radixSortMyList(a, scratch);
+    double radixTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("\nqsort: %.3fs, radix sort: %.3fs, same result: %d\n", qsortTime, radixTime,
+           memcmp(toArray(a), toArray(b), sizeof(int) * n) == 0); // 1
+
+    destoryMyList(a);
+    destoryMyList(b);
+    destroyRadixScratch(scratch);
+
+    return 0;
+}
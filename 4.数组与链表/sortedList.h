@@ -0,0 +1,27 @@
+#ifndef SORTED_LIST_H
+#define SORTED_LIST_H
+
+#include "list.h"
+
+/**
+ * 基数排序的临时缓冲区
+ *
+ * 多次排序时复用同一块内存，避免每次排序都分配。
+ */
+typedef struct
+{
+    int* buf;      // 临时数组
+    int capacity;  // 临时数组能容纳的元素个数
+} RadixScratch;
+
+
+RadixScratch* newRadixScratch();
+void destroyRadixScratch(RadixScratch* scratch);
+void radixSort(int* arr, int size, RadixScratch* scratch);
+void radixSortMyList(MyList* list, RadixScratch* scratch);
+int lowerBound(MyList* list, int target);
+int insertSorted(MyList* list, int val);
+int dedupSorted(MyList* list);
+MyList* mergeSorted(MyList* a, MyList* b);
+
+#endif
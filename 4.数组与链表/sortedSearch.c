@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sortedSearch.h"
+
+/**
+ * 有序数组的查找
+ *
+ * array.c 中的 arrFind 逐个比较，时间复杂度为 O(n)。数组有序时可以二分查找，时间复杂度为 O(log n)。
+ * 但对于放不进缓存的大数组，普通二分查找的瓶颈不是比较次数，而是:
+ * 1. 分支预测失败: 每轮向左还是向右完全取决于数据，大约一半的分支会预测失败;
+ * 2. 内存延迟: 每轮访问的位置依赖上一轮的比较结果，前几轮之后几乎每次访问都是一次缓存未命中。
+ * 这里用三种方法解决:
+ * 1. 无分支的二分查找: 用条件传送代替分支，并预取下一轮可能访问的两个位置;
+ * 2. Eytzinger 布局: 把数组按层序重排，一个缓存行包含同一子树连续几层的节点，可以一次预取 4 层;
+ * 3. 批量查找: 多个查询交错执行，一个查询等待内存时其他查询继续计算，把内存延迟重叠起来。
+ */
+
+/**
+ * 无分支的 lower_bound
+ *
+ * 返回第一个不小于 target 的元素的索引，所有元素都小于 target 时返回 size。
+ * 循环次数只取决于 size，与数据无关，因此不会出现分支预测失败。
+ */
+int lowerBoundArr(const int* arr, int size, int target)
+{
+    if (size == 0)
+        return 0;
+
+    // 答案始终位于 [base, base + n] 中，每轮把区间缩小一半
+    const int* base = arr;
+    int n = size;
+    while (n > 1)
+    {
+        int half = n / 2;
+        // 下一轮访问的位置是 base + half / 2 或 base + half + half / 2，两个都预取
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+        base = (base[half] < target) ? base + half : base;
+        n -= half;
+    }
+
+    return (int)(base - arr) + (*base < target);
+}
+
+
+/**
+ * 批量 lower_bound
+ *
+ * 每次取 SEARCH_BATCH 个查询，按轮次交错执行: 每一轮先让所有查询各前进一步，再进入下一轮。
+ * 同一轮中各查询的内存访问互不依赖，处理器可以同时等待多个缓存未命中。
+ */
+void lowerBoundBatchArr(const int* arr, int size, const int* targets, int m, int* res)
+{
+    if (size == 0)
+    {
+        memset(res, 0, sizeof(int) * (size_t)m);
+        return;
+    }
+
+    const int* base[SEARCH_BATCH];
+    for (int start = 0; start < m; start += SEARCH_BATCH)
+    {
+        int count = m - start < SEARCH_BATCH ? m - start : SEARCH_BATCH;
+        const int* t = targets + start;
+        for (int j = 0; j < count; j++)
+            base[j] = arr;
+
+        // 所有查询的区间长度相同，循环次数也相同
+        int n = size;
+        while (n > 1)
+        {
+            int half = n / 2;
+            for (int j = 0; j < count; j++)
+            {
+                __builtin_prefetch(base[j] + half / 2);
+                __builtin_prefetch(base[j] + half + half / 2);
+                base[j] = (base[j][half] < t[j]) ? base[j] + half : base[j];
+            }
+            n -= half;
+        }
+
+        for (int j = 0; j < count; j++)
+            res[start + j] = (int)(base[j] - arr) + (*base[j] < t[j]);
+    }
+}
+
+
+/* 中序遍历层序树，依次填入有序数组的元素 */
+static int buildTree(EytzingerIndex* index, const int* sorted, int i, int k)
+{
+    if (k <= index->size)
+    {
+        i = buildTree(index, sorted, i, 2 * k);
+        index->tree[k] = sorted[i];
+        if (index->rank != NULL)
+            index->rank[k] = i;
+        i++;
+        i = buildTree(index, sorted, i, 2 * k + 1);
+    }
+
+    return i;
+}
+
+
+/* 按 64 字节(缓存行)对齐分配 count 个 int */
+static int* allocAligned(int count)
+{
+    size_t bytes = (sizeof(int) * (size_t)count + 63) / 64 * 64;
+    int* p = aligned_alloc(64, bytes);
+    if (p == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+
+    return p;
+}
+
+
+/**
+ * 由有序数组构建 Eytzinger 索引
+ *
+ * withRank 非 0 时额外保存每个节点在原数组中的索引，查找后可以换算回原数组的位置。
+ * tree 按缓存行对齐，tree[16k, 16k + 16) 恰好占一个缓存行，即节点 k 往下第 4 层的全部后代。
+ */
+EytzingerIndex* newEytzingerIndex(const int* sorted, int size, int withRank)
+{
+    EytzingerIndex* index = malloc(sizeof(EytzingerIndex));
+    if (index == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    index->size = size;
+    index->tree = allocAligned(size + 1);
+    index->rank = withRank ? allocAligned(size + 1) : NULL;
+    index->tree[0] = 0;
+    if (index->rank != NULL)
+        index->rank[0] = size; // 位置 0 表示所有元素都小于查找值
+    buildTree(index, sorted, 0, 1);
+
+    index->depth = 0;
+    for (int n = size; n > 0; n >>= 1)
+        index->depth++;
+
+    return index;
+}
+
+
+/* 析构函数 */
+void destroyEytzingerIndex(EytzingerIndex* index)
+{
+    if (index != NULL)
+    {
+        free(index->tree);
+        free(index->rank);
+        free(index);
+    }
+}
+
+
+/**
+ * 在 Eytzinger 索引中查找第一个不小于 target 的元素
+ *
+ * 返回该元素在 tree 中的位置 k，所有元素都小于 target 时返回 0。
+ * 查找时 k 的二进制记录了路径(0 向左，1 向右)。最后一次向左的节点就是答案，
+ * 即去掉 k 末尾连续的 1 以及再前面的一个 0。
+ */
+int searchEytzinger(EytzingerIndex* index, int target)
+{
+    const int* tree = index->tree;
+    int k = 1;
+    while (k <= index->size)
+    {
+        __builtin_prefetch(tree + 16 * (size_t)k); // 提前 4 层预取
+        k = 2 * k + (tree[k] < target);
+    }
+    k >>= __builtin_ffs(~k);
+
+    return k;
+}
+
+
+/**
+ * 批量查找
+ *
+ * 树的前 depth - 1 层是满的，所有查询都至少走 depth - 1 步，可以无条件地交错执行;
+ * 最后一步只有部分查询还在树中，已经走出树的查询按“向右”处理，不影响末尾解码的结果。
+ */
+void searchBatchEytzinger(EytzingerIndex* index, const int* targets, int m, int* res)
+{
+    const int* tree = index->tree;
+    int n = index->size;
+    int k[SEARCH_BATCH];
+    for (int start = 0; start < m; start += SEARCH_BATCH)
+    {
+        int count = m - start < SEARCH_BATCH ? m - start : SEARCH_BATCH;
+        const int* t = targets + start;
+        for (int j = 0; j < count; j++)
+            k[j] = 1;
+
+        for (int d = 1; d < index->depth; d++)
+        {
+            for (int j = 0; j < count; j++)
+            {
+                __builtin_prefetch(tree + 16 * (size_t)k[j]);
+                k[j] = 2 * k[j] + (tree[k[j]] < t[j]);
+            }
+        }
+
+        for (int j = 0; j < count; j++)
+        {
+            int inTree = k[j] <= n;
+            // 不在树中时读取 tree[0]，比较结果被忽略
+            k[j] = 2 * k[j] + ((tree[k[j] & -inTree] < t[j]) | !inTree);
+            res[start + j] = k[j] >> __builtin_ffs(~k[j]);
+        }
+    }
+}
+
+
+/* 位置 k 处的元素 */
+int valueEytzinger(EytzingerIndex* index, int k)
+{
+    return index->tree[k];
+}
+
+
+/* 位置 k 处的元素在原有序数组中的索引(需要构建时 withRank 非 0)，k 为 0 时返回 size */
+int rankEytzinger(EytzingerIndex* index, int k)
+{
+    return index->rank != NULL ? index->rank[k] : -1;
+}
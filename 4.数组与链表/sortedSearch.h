@@ -0,0 +1,31 @@
+#ifndef SORTED_SEARCH_H
+#define SORTED_SEARCH_H
+
+/**
+ * Eytzinger 布局的查找索引
+ *
+ * 把有序数组按二叉搜索树的层序(BFS)重新排列: tree[1] 为根，tree[k] 的左右孩子为 tree[2k]、tree[2k + 1]。
+ * 查找路径上的元素在内存中集中在数组开头，并且可以提前预取后几层的节点。
+ */
+typedef struct
+{
+    int* tree;   // 1 起始的层序数组，tree[0] 不使用
+    int* rank;   // rank[k] 为 tree[k] 在原有序数组中的索引，不需要时为 NULL
+    int size;    // 元素数量
+    int depth;   // 树高 floor(log2(size)) + 1
+} EytzingerIndex;
+
+/* 批量查找时交错执行的查询数 */
+#define SEARCH_BATCH 16
+
+
+int lowerBoundArr(const int* arr, int size, int target);
+void lowerBoundBatchArr(const int* arr, int size, const int* targets, int m, int* res);
+EytzingerIndex* newEytzingerIndex(const int* sorted, int size, int withRank);
+void destroyEytzingerIndex(EytzingerIndex* index);
+int searchEytzinger(EytzingerIndex* index, int target);
+void searchBatchEytzinger(EytzingerIndex* index, const int* targets, int m, int* res);
+int valueEytzinger(EytzingerIndex* index, int k);
+int rankEytzinger(EytzingerIndex* index, int k);
+
+#endif
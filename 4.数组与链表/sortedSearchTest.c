@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sortedSearch.h"
+
+/* 编译命令: gcc -O2 sortedSearchTest.c sortedSearch.c -o sortedSearchTest */
+
+
+/* 普通的二分查找，作为对照 */
+static int lowerBoundBranchy(const int* arr, int size, int target)
+{
+    int lo = 0, hi = size;
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        if (arr[mid] < target)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+
+static double elapsed(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+
+int main(void)
+{
+    /**
+     * 在 1600 万个元素的有序数组中查找 400 万次
+     */
+    int n = 1 << 24, m = 1 << 22;
+    int* arr = malloc(sizeof(int) * n);
+    int* targets = malloc(sizeof(int) * m);
+    int* expected = malloc(sizeof(int) * m);
+    int* res = malloc(sizeof(int) * m);
+    if (arr == NULL || targets == NULL || expected == NULL || res == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+
+    srand(1);
+    for (int i = 0; i < n; i++)
+        arr[i] = 3 * i + rand() % 3; // 严格递增
+    for (int j = 0; j < m; j++)
+        targets[j] = rand() % (3 * n + 10) - 5;
+
+    clock_t start = clock();
+    for (int j = 0; j < m; j++)
+        expected[j] = lowerBoundBranchy(arr, n, targets[j]);
+    printf("Branchy binary search:    %.3fs\n", elapsed(start));
+
+    int ok = 1;
+    start = clock();
+    for (int j = 0; j < m; j++)
+        res[j] = lowerBoundArr(arr, n, targets[j]);
+    printf("Branchless binary search: %.3fs\n", elapsed(start));
+    ok &= memcmp(res, expected, sizeof(int) * m) == 0;
+
+    start = clock();
+    lowerBoundBatchArr(arr, n, targets, m, res);
+    printf("Batched binary search:    %.3fs\n", elapsed(start));
+    ok &= memcmp(res, expected, sizeof(int) * m) == 0;
+
+    EytzingerIndex* index = newEytzingerIndex(arr, n, 1);
+    start = clock();
+    for (int j = 0; j < m; j++)
+        res[j] = searchEytzinger(index, targets[j]);
+    printf("Eytzinger search:         %.3fs\n", elapsed(start));
+    for (int j = 0; j < m; j++)
+        ok &= rankEytzinger(index, res[j]) == expected[j];
+
+    start = clock();
+    searchBatchEytzinger(index, targets, m, res);
+    printf("Batched Eytzinger search: %.3fs\n", elapsed(start));
+    for (int j = 0; j < m; j++)
+        ok &= rankEytzinger(index, res[j]) == expected[j];
+    printf("All results correct: %d\n", ok); // 1
+
+    destroyEytzingerIndex(index);
+    free(arr);
+    free(targets);
+    free(expected);
+    free(res);
+
+    return 0;
+}
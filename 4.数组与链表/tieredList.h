@@ -0,0 +1,33 @@
+#ifndef TIERED_LIST_H
+#define TIERED_LIST_H
+
+/**
+ * 分层向量(tiered vector)
+ *
+ * 元素按顺序存放在若干个大小为 blockSize 的环形块中，除最后一块外每块都是满的。
+ * 包含: 块指针数组，每块的起始偏移，块大小，块数量，元素数量
+ */
+typedef struct
+{
+    int** blocks;     // 块指针数组
+    int* offsets;     // 每个环形块中第一个元素的位置
+    int blockCap;     // 块指针数组的容量
+    int numBlocks;    // 已分配的块数量
+    int blockSize;    // 每块的元素个数，总是 2 的幂
+    int shift;        // log2(blockSize)
+    int size;         // 列表中的元素数量
+} TieredList;
+
+
+TieredList* newTieredList();
+void destoryTieredList(TieredList* list);
+int sizeTieredList(TieredList* list);
+int capacityTieredList(TieredList* list);
+int getElementTieredList(TieredList* list, int index);
+int setElementTieredList(TieredList* list, int index, int val);
+void pushElementTieredList(TieredList* list, int val);
+void insertElementTieredList(TieredList* list, int index, int val);
+int delElementTieredList(TieredList* list, int index);
+int* toArrayTieredList(TieredList* list);
+
+#endif
@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "tieredList.h"
+#include "array.h"
+
+/* 编译命令: gcc -O2 tieredListTest.c tieredList.c array.c -o tieredListTest */
+
+
+int main(void)
+{
+    /**
+     * 分层向量测试
+     */
+    TieredList* list = newTieredList();
+    for (int i = 0; i < 5; i++)
+    {
+        pushElementTieredList(list, i + 1);
+    }
+    arrPrint(toArrayTieredList(list), sizeTieredList(list)); // [1, 2, 3, 4, 5]
+
+    // 插入、删除、访问、更新
+    insertElementTieredList(list, 3, 6);
+    delElementTieredList(list, 0);
+    setElementTieredList(list, 0, 9);
+    printf("Element 2: %d\n", getElementTieredList(list, 2)); // 6
+
+    // toArray 返回的数组可写，修改直接反映到列表中
+    toArrayTieredList(list)[1] = 7;
+    arrPrint(toArrayTieredList(list), sizeTieredList(list)); // [9, 7, 6, 4, 5]
+    printf("\n");
+    destoryTieredList(list);
+
+    /**
+     * 大量中间插入与删除: 每次只移动 O(sqrt(n)) 个元素
+     */
+    int n = 200000;
+    list = newTieredList();
+    clock_t start = clock();
+    for (int i = 0; i < n; i++)
+    {
+        insertElementTieredList(list, sizeTieredList(list) / 2, i);
+    }
+    for (int i = 0; i < n / 2; i++)
+    {
+        delElementTieredList(list, sizeTieredList(list) / 3);
+    }
+    printf("Size: %d, block size: %d, %.3fs\n", sizeTieredList(list), list->blockSize,
+           (double)(clock() - start) / CLOCKS_PER_SEC);
+    destoryTieredList(list);
+
+    return 0;
+}
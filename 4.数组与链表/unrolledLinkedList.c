@@ -0,0 +1,384 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "unrolledLinkedList.h"
+#include "array.h"
+
+/* 编译命令: gcc -O2 unrolledLinkedList.c array.c -o unrolledLinkedList */
+
+/**
+ * 展开链表(unrolled linked list)
+ *
+ * linkedList.c 中每个节点只存放一个 int，遍历时每前进一步都要读取一次 next 指针，
+ * 节点散落在内存各处，几乎每一步都是一次缓存未命中，findNode / accessNode 比遍历数组慢得多。
+ * 展开链表的每个节点是按缓存行对齐的一小段元素数组:
+ * 1. 遍历: 节点内部是连续数组，一次缓存未命中换来 UNROLL_CAPACITY 个元素，节点内的比较还可以向量化;
+ * 2. 插入: 只移动节点内的元素，时间复杂度为 O(UNROLL_CAPACITY) = O(1)。节点满时分裂为两个半满的节点;
+ * 3. 删除: 节点内元素少于一半时，从后继节点借元素，或者与后继节点合并，保证节点不会过于稀疏。
+ */
+
+#define UNROLL_HALF (UNROLL_CAPACITY / 2)
+
+/* 内存池从缓存行边界开始按节点大小切分，节点大小是缓存行的整数倍时每个节点都按缓存行对齐 */
+_Static_assert(sizeof(UnrolledNode) == UNROLL_NODE_LINES * CACHE_LINE, "UnrolledNode must fill whole cache lines");
+
+
+/* 构造函数 */
+UnrolledList* newUnrolledList()
+{
+    UnrolledList* list = (UnrolledList*)malloc(sizeof(UnrolledList));
+    if (list == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->pool = newNodePool(sizeof(UnrolledNode), 0);
+
+    return list;
+}
+
+
+/* 析构函数: 节点全部在内存池中，销毁内存池即可 */
+void destroyUnrolledList(UnrolledList* list)
+{
+    if (list != NULL)
+    {
+        destroyNodePool(list->pool);
+        free(list);
+    }
+}
+
+
+/* 获取元素数量 */
+int sizeUnrolledList(UnrolledList* list)
+{
+    return list->size;
+}
+
+
+/* 在 node 之后创建一个空节点，node 为 NULL 时作为头节点 */
+static UnrolledNode* newUnrolledNode(UnrolledList* list, UnrolledNode* node)
+{
+    UnrolledNode* m = (UnrolledNode*)poolAlloc(list->pool);
+    m->count = 0;
+    m->prev = node;
+    m->next = node != NULL ? node->next : list->head;
+    if (m->next != NULL)
+        m->next->prev = m;
+    else
+        list->tail = m;
+    if (node != NULL)
+        node->next = m;
+    else
+        list->head = m;
+
+    return m;
+}
+
+
+/* 从链表中摘除节点并放回内存池 */
+static void removeUnrolledNode(UnrolledList* list, UnrolledNode* node)
+{
+    if (node->prev != NULL)
+        node->prev->next = node->next;
+    else
+        list->head = node->next;
+    if (node->next != NULL)
+        node->next->prev = node->prev;
+    else
+        list->tail = node->prev;
+    poolFree(list->pool, node);
+}
+
+
+/**
+ * 在节点 node 的 offset 处插入元素，返回新元素的位置
+ *
+ * 节点已满时先把后一半元素移到新节点中，再插入到对应的一半。
+ */
+static UnrolledPos insertInNode(UnrolledList* list, UnrolledNode* node, int offset, int val)
+{
+    if (node->count == UNROLL_CAPACITY)
+    {
+        UnrolledNode* m = newUnrolledNode(list, node);
+        memcpy(m->vals, node->vals + UNROLL_HALF, sizeof(int) * (UNROLL_CAPACITY - UNROLL_HALF));
+        m->count = UNROLL_CAPACITY - UNROLL_HALF;
+        node->count = UNROLL_HALF;
+        if (offset > UNROLL_HALF)
+        {
+            node = m;
+            offset -= UNROLL_HALF;
+        }
+    }
+
+    memmove(node->vals + offset + 1, node->vals + offset, sizeof(int) * (size_t)(node->count - offset));
+    node->vals[offset] = val;
+    node->count++;
+    list->size++;
+
+    UnrolledPos pos = {node, offset};
+    return pos;
+}
+
+
+/* 访问索引为 index 的元素的位置，逐个节点跳过，时间复杂度为 O(n / UNROLL_CAPACITY) */
+UnrolledPos accessUnrolled(UnrolledList* list, int index)
+{
+    UnrolledPos pos = {NULL, 0};
+    if (index < 0 || index >= list->size)
+        return pos;
+
+    UnrolledNode* node = list->head;
+    while (index >= node->count)
+    {
+        index -= node->count;
+        node = node->next;
+    }
+    pos.node = node;
+    pos.offset = index;
+
+    return pos;
+}
+
+
+/* 位置对应的元素 */
+int getUnrolled(UnrolledPos pos)
+{
+    return pos.node->vals[pos.offset];
+}
+
+
+/* 查找元素，返回索引，未找到返回 -1 */
+int findUnrolled(UnrolledList* list, int target)
+{
+    int base = 0;
+    for (UnrolledNode* node = list->head; node != NULL; node = node->next)
+    {
+        // 先统计节点内是否存在 target: 固定长度、无提前退出的循环可以向量化
+        int hit = 0;
+        for (int i = 0; i < UNROLL_CAPACITY; i++)
+            hit |= (i < node->count) & (node->vals[i] == target);
+        if (hit)
+        {
+            for (int i = 0; i < node->count; i++)
+            {
+                if (node->vals[i] == target)
+                    return base + i;
+            }
+        }
+        base += node->count;
+    }
+
+    return -1;
+}
+
+
+/* 遍历求和 */
+long long sumUnrolled(UnrolledList* list)
+{
+    long long sum = 0;
+    for (UnrolledNode* node = list->head; node != NULL; node = node->next)
+    {
+        for (int i = 0; i < node->count; i++)
+            sum += node->vals[i];
+    }
+
+    return sum;
+}
+
+
+/* 在尾部追加元素 */
+void pushUnrolled(UnrolledList* list, int val)
+{
+    UnrolledNode* tail = list->tail;
+    if (tail == NULL || tail->count == UNROLL_CAPACITY)
+        tail = newUnrolledNode(list, tail); // 尾节点满时直接新建，保持已有节点满载
+    tail->vals[tail->count++] = val;
+    list->size++;
+}
+
+
+/**
+ * 在位置 pos 的元素之后插入元素，返回新元素的位置
+ *
+ * 与 linkedList.c 中的 insertNode 一样不需要从头遍历，时间复杂度为 O(1)。
+ */
+UnrolledPos insertAfterUnrolled(UnrolledList* list, UnrolledPos pos, int val)
+{
+    return insertInNode(list, pos.node, pos.offset + 1, val);
+}
+
+
+/* 在索引 index 处插入元素 */
+void insertUnrolled(UnrolledList* list, int index, int val)
+{
+    if (index < 0 || index > list->size)
+        exit(1);
+
+    if (index == list->size)
+    {
+        pushUnrolled(list, val);
+        return;
+    }
+    UnrolledPos pos = accessUnrolled(list, index);
+    insertInNode(list, pos.node, pos.offset, val);
+}
+
+
+/**
+ * 删除位置 pos 的元素，返回被删除的元素
+ *
+ * 节点内元素少于一半时: 与后继节点合起来放得下就合并，否则从后继节点借元素，使两者都不少于一半。
+ * 没有后继节点时，只在节点变空时删除节点。
+ */
+int deleteAtUnrolled(UnrolledList* list, UnrolledPos pos)
+{
+    UnrolledNode* node = pos.node;
+    int val = node->vals[pos.offset];
+    memmove(node->vals + pos.offset, node->vals + pos.offset + 1,
+            sizeof(int) * (size_t)(node->count - pos.offset - 1));
+    node->count--;
+    list->size--;
+
+    UnrolledNode* next = node->next;
+    if (node->count >= UNROLL_HALF)
+        return val;
+
+    if (next == NULL)
+    {
+        if (node->count == 0)
+            removeUnrolledNode(list, node);
+    }
+    else if (node->count + next->count <= UNROLL_CAPACITY)
+    {
+        // 合并
+        memcpy(node->vals + node->count, next->vals, sizeof(int) * (size_t)next->count);
+        node->count += next->count;
+        removeUnrolledNode(list, next);
+    }
+    else
+    {
+        // 借元素: 把后继节点开头的 k 个元素移过来
+        int k = (next->count - node->count) / 2;
+        memcpy(node->vals + node->count, next->vals, sizeof(int) * (size_t)k);
+        memmove(next->vals, next->vals + k, sizeof(int) * (size_t)(next->count - k));
+        node->count += k;
+        next->count -= k;
+    }
+
+    return val;
+}
+
+
+/* 删除索引为 index 的元素，越界返回 -1 */
+int deleteUnrolled(UnrolledList* list, int index)
+{
+    UnrolledPos pos = accessUnrolled(list, index);
+    if (pos.node == NULL)
+        return -1;
+
+    return deleteAtUnrolled(list, pos);
+}
+
+
+/* 把全部元素拷贝到 res 中(res 至少能容纳 size 个元素) */
+int* toArrayUnrolled(UnrolledList* list, int* res)
+{
+    int* out = res;
+    for (UnrolledNode* node = list->head; node != NULL; node = node->next)
+    {
+        memcpy(out, node->vals, sizeof(int) * (size_t)node->count);
+        out += node->count;
+    }
+
+    return res;
+}
+
+
+/* 普通链表节点，作为对照 */
+typedef struct PlainNode
+{
+    int val;
+    struct PlainNode* next;
+} PlainNode;
+
+
+int main(void)
+{
+    /**
+     * 基本操作
+     */
+    UnrolledList* list = newUnrolledList();
+    for (int i = 0; i < 40; i++)
+        pushUnrolled(list, i);
+
+    UnrolledPos pos = accessUnrolled(list, 5);
+    pos = insertAfterUnrolled(list, pos, 100); // 在元素 5 之后插入
+    insertAfterUnrolled(list, pos, 101);
+    insertUnrolled(list, 0, -1);
+    printf("Index of 100: %d\n", findUnrolled(list, 100)); // 7
+    printf("Element 8: %d\n", getUnrolled(accessUnrolled(list, 8))); // 101
+
+    for (int i = 0; i < 20; i++)
+        deleteUnrolled(list, 10); // 触发借元素与合并
+    int res[64];
+    toArrayUnrolled(list, res);
+    arrPrint(res, sizeUnrolledList(list)); // [-1, 0, 1, 2, 3, 4, 5, 100, 101, 6, 27, 28, ..., 39]
+    destroyUnrolledList(list);
+
+    /**
+     * 遍历与查找: 与每个节点只存放一个元素的链表对比
+     */
+    int n = 1 << 22;
+    list = newUnrolledList();
+    for (int i = 0; i < n; i++)
+        pushUnrolled(list, i);
+
+    // 长期增删后，普通链表相邻的节点在内存中不再相邻: 按随机顺序连接节点来模拟
+    NodePool* pool = newNodePool(sizeof(PlainNode), 0);
+    PlainNode** nodes = malloc(sizeof(PlainNode*) * n);
+    for (int i = 0; i < n; i++)
+        nodes[i] = (PlainNode*)poolAlloc(pool);
+    srand(1);
+    for (int i = n - 1; i > 0; i--)
+    {
+        int j = rand() % (i + 1);
+        PlainNode* t = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = t;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        nodes[i]->val = i;
+        nodes[i]->next = i + 1 < n ? nodes[i + 1] : NULL;
+    }
+    PlainNode* head = nodes[0];
+    free(nodes);
+
+    int target = n - 1;
+    clock_t start = clock();
+    int index = 0;
+    for (PlainNode* p = head; p != NULL && p->val != target; p = p->next)
+        index++;
+    printf("Linked list find: %d, %.3fs\n", index, (double)(clock() - start) / CLOCKS_PER_SEC);
+
+    start = clock();
+    index = findUnrolled(list, target);
+    printf("Unrolled list find: %d, %.3fs\n", index, (double)(clock() - start) / CLOCKS_PER_SEC);
+
+    // 中间插入只移动一个节点内的元素
+    start = clock();
+    pos = accessUnrolled(list, n / 2);
+    for (int i = 0; i < 100000; i++)
+        pos = insertAfterUnrolled(list, pos, -i);
+    printf("100000 inserts in the middle: %.3fs, size: %d\n",
+           (double)(clock() - start) / CLOCKS_PER_SEC, sizeUnrolledList(list));
+
+    destroyNodePool(pool);
+    destroyUnrolledList(list);
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include "nodePool.h"
+
+/* 每个节点占用的缓存行数 */
+#define UNROLL_NODE_LINES 2
+/* 每个节点存放的元素个数: 节点头部之后剩余的空间全部用来存放元素 */
+#define UNROLL_CAPACITY \
+    ((int)((UNROLL_NODE_LINES * CACHE_LINE - 2 * sizeof(void*) - sizeof(int)) / sizeof(int)))
+
+/**
+ * 展开链表的节点
+ *
+ * 一个节点存放最多 UNROLL_CAPACITY 个元素，除尾节点外元素数量保持在容量的一半以上。
+ * 节点按缓存行对齐，大小恰好为 UNROLL_NODE_LINES 个缓存行: 头部与前几个元素位于第一个缓存行，
+ * 其余元素填满后面的缓存行，访问一个节点最多读取 UNROLL_NODE_LINES 个缓存行。
+ */
+typedef struct UnrolledNode
+{
+    struct UnrolledNode* prev;
+    struct UnrolledNode* next;
+    int count;                   // 节点中的元素数量
+    int vals[UNROLL_CAPACITY];   // 元素
+} __attribute__((aligned(CACHE_LINE))) UnrolledNode;
+
+/* 元素位置: 所在节点及节点内的偏移，插入、删除后失效 */
+typedef struct
+{
+    UnrolledNode* node;   // 越界时为 NULL
+    int offset;
+} UnrolledPos;
+
+/**
+ * 展开链表
+ *
+ * 包含: 头节点，尾节点，元素数量，节点内存池
+ */
+typedef struct
+{
+    UnrolledNode* head;
+    UnrolledNode* tail;
+    int size;
+    NodePool* pool;
+} UnrolledList;
+
+
+UnrolledList* newUnrolledList();
+void destroyUnrolledList(UnrolledList* list);
+int sizeUnrolledList(UnrolledList* list);
+UnrolledPos accessUnrolled(UnrolledList* list, int index);
+int getUnrolled(UnrolledPos pos);
+int findUnrolled(UnrolledList* list, int target);
+long long sumUnrolled(UnrolledList* list);
+void pushUnrolled(UnrolledList* list, int val);
+UnrolledPos insertAfterUnrolled(UnrolledList* list, UnrolledPos pos, int val);
+void insertUnrolled(UnrolledList* list, int index, int val);
+int deleteAtUnrolled(UnrolledList* list, UnrolledPos pos);
+int deleteUnrolled(UnrolledList* list, int index);
+int* toArrayUnrolled(UnrolledList* list, int* res);
+
+#endif
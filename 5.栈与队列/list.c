@@ -1,26 +1,187 @@
+#define _GNU_SOURCE // mremap
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
 #include "list.h"
+#include "alignedAlloc.h"
 
 
-/* 构造函数 */
-MyList* newMyList()
+#ifdef MYLIST_STATS
+/**
+ * 全局统计
+ *
+ * 汇总进程内所有列表的容量调整情况。不同线程中的列表可能同时更新，因此使用原子操作;
+ * 调整容量和创建、销毁列表时更新容量，元素数量变化时只做一次原子加法，用于计算全局空闲容量。
+ * 共享数组的容量和元素数量只计一次: 共享期间记在共享数组上，各列表自己持有的部分为 0;
+ * 最后一个引用释放时扣除，某个列表拷贝出独占数组时再计入该列表。
+ */
+static ListStats globalStats;
+static long long globalSize; // 所有存活列表的元素数量之和
+
+/* 列表自己持有的容量 */
+static long long ownedCapacity(MyList* list)
+{
+    return list->storage == STORAGE_SHARED ? 0 : capacity(list);
+}
+
+/* 列表自己持有的元素数量 */
+static long long ownedSize(MyList* list)
+{
+    return list->storage == STORAGE_SHARED ? 0 : size(list);
+}
+
+/* 记录存活列表的元素数量变化 */
+static inline void statsTrackSize(long long delta)
+{
+    __atomic_fetch_add(&globalSize, delta, __ATOMIC_RELAXED);
+}
+
+/* 记录存活列表的容量变化 */
+static void statsTrackCapacity(MyList* list, long long delta)
+{
+    __atomic_fetch_add(&globalStats.capacity, delta, __ATOMIC_RELAXED);
+    if (capacity(list) > list->stats.peakCapacity)
+        list->stats.peakCapacity = capacity(list);
+
+    long long peak = __atomic_load_n(&globalStats.peakCapacity, __ATOMIC_RELAXED);
+    while (capacity(list) > peak &&
+           !__atomic_compare_exchange_n(&globalStats.peakCapacity, &peak, (long long)capacity(list),
+                                        1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+}
+
+/* 当前时间(纳秒) */
+static long long nowNanos()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+#else
+static inline void statsTrackSize(long long delta)
+{
+    (void)delta;
+}
+#endif
+
+
+/**
+ * 初始化列表
+ *
+ * 元素先存放在结构体内部的 inlineArr 中，溢出后才分配堆内存。
+ * 列表可以直接定义在栈上或嵌入其他结构体中，此时整个生命周期都不调用 malloc;
+ * 注意初始化后不能按值拷贝 MyList，否则 arr 仍指向原结构体的 inlineArr。
+ */
+void initMyList(MyList* list)
 {
-    MyList* list = (MyList*)malloc(sizeof(MyList));
-    list->capacity = 10; // 列表容量默认初始化为10
-    list->arr = malloc(sizeof(int) * list->capacity); // 为列表内部数组分配内存
+    list->capacity = MYLIST_INLINE_SIZE; // 列表容量默认初始化为内部存储的大小
+    list->arr = list->inlineArr;
     list->size = 0;
     list->extendRadio = 2;
+    list->shrinkRadio = 4; // 元素数量不足容量的 1/4 时容量减半
+    list->storage = STORAGE_INLINE;
+    list->shared = NULL;
+    list->mapBytes = 0;
+    list->copiedBytes = 0;
+    list->gapMode = 0;
+    list->gapStart = 0;
+    list->gapLen = 0;
+    list->generation = 0;
+#ifdef MYLIST_STATS
+    memset(&list->stats, 0, sizeof(list->stats));
+    statsTrackCapacity(list, capacity(list));
+#endif
+}
+
+
+/* 构造函数 */
+MyList* newMyList()
+{
+    MyList* list = (MyList*)alignedAlloc(sizeof(MyList)); // 内部数组随结构体一起分配，按缓存行对齐
+    if (list == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    initMyList(list);
 
     return list;
 }
 
 
+/* 按存储方式释放数组 */
+static void releaseBuffer(ListStorage storage, int* arr, size_t mapBytes)
+{
+    if (storage == STORAGE_MMAP)
+        munmap(arr, mapBytes);
+    else if (storage == STORAGE_FILE)
+        munmap((char*)arr - sizeof(ListFileHeader), mapBytes); // 映射从文件头开始
+    else if (storage == STORAGE_HEAP)
+        free(arr);
+}
+
+
+/* 释放内部数组(不释放结构体本身)，共享数组只减少引用计数 */
+static void releaseArray(MyList* list)
+{
+    if (list->storage == STORAGE_SHARED)
+    {
+        SharedArray* shared = list->shared;
+        if (__atomic_sub_fetch(&shared->refCount, 1, __ATOMIC_ACQ_REL) == 0)
+        {
+#ifdef MYLIST_STATS
+            // 共享期间列表不修改数组，容量和元素数量与共享时相同
+            statsTrackCapacity(list, -(long long)capacity(list));
+            statsTrackSize(-(long long)size(list));
+#endif
+            releaseBuffer(shared->storage, shared->arr, shared->mapBytes);
+            free(shared);
+        }
+        list->shared = NULL;
+    }
+    else
+    {
+        releaseBuffer(list->storage, list->arr, list->mapBytes);
+    }
+}
+
+
+/* 释放由 initMyList 初始化的列表占用的内存，并恢复为空列表(保留扩容历史) */
+void releaseMyList(MyList* list)
+{
+#ifdef MYLIST_STATS
+    statsTrackCapacity(list, -ownedCapacity(list));
+    statsTrackSize(-ownedSize(list));
+    ListStats stats = list->stats;
+#endif
+    unsigned generation = list->generation;
+    long long copied = list->copiedBytes;
+    releaseArray(list);
+    initMyList(list);
+    list->generation = generation + 1; // 旧数组已失效
+    list->copiedBytes = copied;
+#ifdef MYLIST_STATS
+    // 列表被复用时继续累计，峰值取两者中较大的
+    if (list->stats.peakCapacity > stats.peakCapacity)
+        stats.peakCapacity = list->stats.peakCapacity;
+    list->stats = stats;
+#endif
+}
+
+
 /* 析构函数 */
 void destoryMyList(MyList* list)
 {
     if (list != NULL) {
-        free(list->arr);
+#ifdef MYLIST_STATS
+        statsTrackCapacity(list, -ownedCapacity(list));
+        statsTrackSize(-ownedSize(list));
+#endif
+        releaseArray(list);
         list->arr = NULL;
         free(list);
         list = NULL;
@@ -42,28 +203,364 @@ int capacity(MyList* list)
 }
 
 
+/**
+ * 间隙缓冲区(gap buffer)
+ *
+ * 在光标附近反复插入、删除时，普通列表每次都要移动光标之后的全部元素，时间复杂度为 O(n)。
+ * 间隙缓冲区把空闲容量作为一个“间隙”留在光标处，数组的物理布局为:
+ *   [0, gapStart) 元素 | [gapStart, gapStart + gapLen) 间隙 | 其余元素
+ * 在间隙处插入只需填充间隙的第一个位置，删除只需把元素并入间隙，时间复杂度为 O(1)。
+ * 光标移动时只需搬运光标新旧位置之间的元素。
+ *
+ * gapLen 为 0 时物理布局与普通列表相同。
+ * 其他需要连续数组的操作会先调用 closeGap 把间隙合并到数组末尾(惰性压缩)。
+ */
+
+/* 把逻辑索引转换为物理索引: 位于间隙之后的元素需要跳过间隙(编译为条件传送，无分支) */
+static inline int physIndex(MyList* list, int index)
+{
+    return index + (index >= list->gapStart ? list->gapLen : 0);
+}
+
+
+/* 把间隙移动到逻辑索引 index 处 */
+static void moveGap(MyList* list, int index)
+{
+    if (list->gapLen == 0)
+    {
+        // 还没有间隙: 把 [index, size) 移到数组末尾，全部空闲容量都成为间隙
+        int gapLen = capacity(list) - size(list);
+        memmove(list->arr + index + gapLen, list->arr + index,
+                sizeof(int) * (size_t)(size(list) - index));
+        list->gapLen = gapLen;
+    }
+    else if (index < list->gapStart)
+    {
+        // 间隙左移: [index, gapStart) 搬到间隙右侧
+        memmove(list->arr + index + list->gapLen, list->arr + index,
+                sizeof(int) * (size_t)(list->gapStart - index));
+    }
+    else if (index > list->gapStart)
+    {
+        // 间隙右移: 间隙之后的 index - gapStart 个元素搬到间隙左侧
+        memmove(list->arr + list->gapStart, list->arr + list->gapStart + list->gapLen,
+                sizeof(int) * (size_t)(index - list->gapStart));
+    }
+    list->gapStart = index;
+    list->generation++; // 元素的物理位置发生了变化
+}
+
+
+/* 合并间隙，使元素重新连续存放 */
+static void closeGap(MyList* list)
+{
+    if (list->gapLen == 0)
+        return;
+
+    memmove(list->arr + list->gapStart, list->arr + list->gapStart + list->gapLen,
+            sizeof(int) * (size_t)(size(list) - list->gapStart));
+    list->gapStart = size(list);
+    list->gapLen = 0;
+    list->generation++;
+}
+
+
+/**
+ * 启用或关闭间隙缓冲区模式
+ *
+ * 启用后 insertElement / delElement 在间隙处完成，适合围绕光标的连续编辑。
+ * 间隙存在时 list->arr 不再是连续数组，需要通过 getElement 或 readArray 读取元素。
+ */
+void setGapBuffer(MyList* list, int enable)
+{
+    if (!enable)
+        closeGap(list);
+    list->gapMode = enable;
+}
+
+
+/**
+ * 写时复制
+ *
+ * cloneMyList 不拷贝元素，而是让两个列表共享同一个数组并增加引用计数，时间复杂度为 O(1)。
+ * 所有修改数组的操作都先调用 detachMyList:
+ * 1. 数组只剩当前列表在使用时，直接收回所有权，不拷贝;
+ * 2. 否则把元素拷贝到新的数组中，只有第一次写入共享数组的一方付出拷贝的代价。
+ * 共享数组不会带有间隙，克隆前会先合并间隙。
+ */
+
+/* 共享数组只剩当前列表引用时，恢复数组原本的存储方式 */
+static void detachShared(MyList* list)
+{
+    if (list->storage != STORAGE_SHARED ||
+        __atomic_load_n(&list->shared->refCount, __ATOMIC_ACQUIRE) != 1)
+        return;
+
+    list->storage = list->shared->storage;
+    list->mapBytes = list->shared->mapBytes;
+    free(list->shared);
+    list->shared = NULL;
+}
+
+
+/* 克隆列表，与原列表共享数组 */
+MyList* cloneMyList(MyList* list)
+{
+    MyList* clone = newMyList();
+    clone->extendRadio = list->extendRadio;
+    clone->shrinkRadio = list->shrinkRadio;
+    clone->gapMode = list->gapMode;
+
+    if (list->storage == STORAGE_INLINE)
+    {
+        // 内部存储的元素很少，直接拷贝
+        closeGap(list);
+        memcpy(clone->inlineArr, list->arr, sizeof(int) * (size_t)size(list));
+        clone->size = size(list);
+        statsTrackSize(size(clone));
+        return clone;
+    }
+
+    closeGap(list);
+    if (list->storage != STORAGE_SHARED)
+    {
+        SharedArray* shared = (SharedArray*)malloc(sizeof(SharedArray));
+        if (shared == NULL) {
+            fprintf(stderr, "Memory allocation failed!\n");
+            exit(1);
+        }
+        shared->refCount = 1;
+        shared->storage = list->storage;
+        shared->arr = list->arr;
+        shared->mapBytes = list->mapBytes;
+        list->storage = STORAGE_SHARED;
+        list->shared = shared;
+    }
+    __atomic_add_fetch(&list->shared->refCount, 1, __ATOMIC_RELAXED);
+
+#ifdef MYLIST_STATS
+    // 共享数组已经计入统计，克隆不再持有自己的数组
+    statsTrackCapacity(clone, -ownedCapacity(clone));
+#endif
+    clone->arr = list->arr;
+    clone->capacity = capacity(list);
+    clone->size = size(list);
+    clone->storage = STORAGE_SHARED;
+    clone->shared = list->shared;
+    clone->mapBytes = list->mapBytes;
+
+    return clone;
+}
+
+
+/* 写入前调用: 数组被其他列表共享时，先拷贝一份独占的数组 */
+void detachMyList(MyList* list)
+{
+    if (list->storage != STORAGE_SHARED)
+        return;
+
+    detachShared(list);
+    if (list->storage == STORAGE_SHARED)
+        resizeCapacity(list, capacity(list));
+}
+
+
+/**
+ * 调整列表内部数组的容量
+ *
+ * 1. 堆存储: 使用 realloc，分配器能原地扩展时不拷贝任何数据;
+ *    堆存储的数组小于 MMAP_THRESHOLD，分配器在堆中分配，realloc 搬迁时按有效元素的字节数记为拷贝量。
+ *    堆上的数组都按缓存行对齐(alignedAlloc.h)。
+ * 2. 容量超过 MMAP_THRESHOLD 时，从堆存储切换到 mmap 存储，只拷贝一次有效元素。
+ * 3. mmap 存储: 使用 mremap，内核直接重新映射物理页，不拷贝数据。映射区按大页对齐并请求透明大页。
+ * 4. 内部存储: 容量不超过 MYLIST_INLINE_SIZE 时使用结构体内部数组，溢出时拷贝到堆上。
+ * 5. 文件存储: 文件映射的长度固定，调整容量时把有效元素拷贝到新的内存中。
+ * 6. 共享存储: 仍被其他列表共享时拷贝到新的内存中，否则先收回所有权再按原存储方式处理。
+ */
+void resizeCapacity(MyList* list, int newCapacity)
+{
+#ifdef MYLIST_STATS
+    long long startNanos = nowNanos();
+    long long startCopied = list->copiedBytes;
+    int oldCapacity = capacity(list);
+#endif
+    closeGap(list);
+    detachShared(list);
+    int* oldArr = list->arr;
+#ifdef MYLIST_STATS
+    long long oldOwnedCapacity = ownedCapacity(list);
+    long long oldOwnedSize = ownedSize(list);
+#endif
+
+    size_t newBytes = sizeof(int) * (size_t)newCapacity;
+    size_t oldBytes = sizeof(int) * (size_t)capacity(list);
+    size_t liveBytes = sizeof(int) * (size_t)size(list);
+
+    if (newCapacity <= MYLIST_INLINE_SIZE)
+    {
+        // 容量足够小时回到结构体内部存储
+        if (list->storage != STORAGE_INLINE)
+        {
+            memcpy(list->inlineArr, list->arr, liveBytes);
+            list->copiedBytes += (long long)liveBytes;
+            releaseArray(list);
+            list->arr = list->inlineArr;
+            list->storage = STORAGE_INLINE;
+            list->mapBytes = 0;
+        }
+        newCapacity = MYLIST_INLINE_SIZE;
+    }
+    else if (list->storage == STORAGE_MMAP)
+    {
+        void* extend = hugeRemap(list->arr, &list->mapBytes, newBytes, liveBytes, &list->copiedBytes);
+        if (extend == MAP_FAILED) {
+            fprintf(stderr, "Memory allocation failed!\n");
+            exit(1);  // 内存分配失败时，终止程序
+        }
+        list->arr = extend;
+    }
+    else if (newBytes >= MMAP_THRESHOLD)
+    {
+        size_t mapBytes;
+        void* extend = hugeMap(newBytes, &mapBytes);
+        if (extend == MAP_FAILED) {
+            fprintf(stderr, "Memory allocation failed!\n");
+            exit(1);
+        }
+        // 从堆迁移到映射区，只需拷贝有效元素
+        memcpy(extend, list->arr, liveBytes);
+        list->copiedBytes += (long long)liveBytes;
+        releaseArray(list);
+
+        list->arr = extend;
+        list->storage = STORAGE_MMAP;
+        list->mapBytes = mapBytes;
+    }
+    else if (list->storage == STORAGE_INLINE || list->storage == STORAGE_FILE ||
+             list->storage == STORAGE_SHARED)
+    {
+        // 内部存储溢出、文件映射需要扩容或数组仍被共享，转移到堆上
+        int* extend = (int*)alignedAlloc(newBytes);
+        if (extend == NULL) {
+            fprintf(stderr, "Memory allocation failed!\n");
+            exit(1);
+        }
+        memcpy(extend, list->arr, liveBytes);
+        list->copiedBytes += (long long)liveBytes;
+        releaseArray(list);
+
+        list->arr = extend;
+        list->storage = STORAGE_HEAP;
+        list->mapBytes = 0;
+    }
+    else
+    {
+        int* extend = (int*)alignedRealloc(list->arr, oldBytes, newBytes, &list->copiedBytes);
+        if (extend == NULL) {
+            fprintf(stderr, "Memory allocation failed!\n");
+            exit(1);
+        }
+        // 新旧数组都小于 MMAP_THRESHOLD，不是 mmap 分配的块: 搬迁时分配器拷贝了整个旧块
+        if (extend != oldArr)
+            list->copiedBytes += (long long)(oldBytes < newBytes ? oldBytes : newBytes);
+        list->arr = extend;
+    }
+
+    list->capacity = newCapacity;
+    // 内部数组搬迁后，指向旧数组的视图全部失效
+    if (list->arr != oldArr)
+        list->generation++;
+
+#ifdef MYLIST_STATS
+    ListStats delta;
+    memset(&delta, 0, sizeof(delta));
+    delta.growEvents = newCapacity > oldCapacity;
+    delta.shrinkEvents = newCapacity < oldCapacity;
+    delta.copiedBytes = list->copiedBytes - startCopied;
+    delta.resizeNanos = nowNanos() - startNanos;
+
+    list->stats.growEvents += delta.growEvents;
+    list->stats.shrinkEvents += delta.shrinkEvents;
+    list->stats.copiedBytes += delta.copiedBytes;
+    list->stats.resizeNanos += delta.resizeNanos;
+    __atomic_fetch_add(&globalStats.growEvents, delta.growEvents, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&globalStats.shrinkEvents, delta.shrinkEvents, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&globalStats.copiedBytes, delta.copiedBytes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&globalStats.resizeNanos, delta.resizeNanos, __ATOMIC_RELAXED);
+    // 仍被共享的数组拷贝成独占数组时，容量和元素数量改为计入本列表
+    statsTrackCapacity(list, ownedCapacity(list) - oldOwnedCapacity);
+    statsTrackSize(ownedSize(list) - oldOwnedSize);
+#endif
+}
+
+
 /* 扩容列表 */
 void extendCapacity(MyList* list)
 {
-    // 先分配空间: 容量 * 扩容倍数
+    // 容量 * 扩容倍数
     int newCapacity = capacity(list) * list->extendRadio; // 计算目的扩容倍数
-    int* extend = (int*)malloc(sizeof(int) * newCapacity); // 拿到扩容后的内存
-    if (extend == NULL) {
-        fprintf(stderr, "Memory allocation failed!\n");
-        exit(1);  // 内存分配失败时，终止程序
-    }
-    int* temp = list->arr;
+    resizeCapacity(list, newCapacity);
+}
 
-    // 拷贝旧数据到新数据
-    for(int i = 0; i < size(list); i++)
-        extend[i] = list->arr[i];
 
-    // 释放旧数据
-    free(temp);
+/* 按扩容倍数扩容，直到容量不小于 minCapacity */
+static void reserveCapacity(MyList* list, int minCapacity)
+{
+    if (minCapacity <= capacity(list))
+        return;
 
-    // 更新新数据
-    list->arr = extend;
-    list->capacity = newCapacity;
+    int newCapacity = capacity(list);
+    while (newCapacity < minCapacity)
+        newCapacity *= list->extendRadio;
+    resizeCapacity(list, newCapacity);
+}
+
+
+/**
+ * 设置缩容策略
+ *
+ * 当元素数量低于 容量/shrinkRadio 时，把容量缩小为 容量/extendRadio。
+ * 为了避免在边界处反复扩容、缩容(抖动)，要求 shrinkRadio > extendRadio:
+ * 这样缩容后列表仍留有空闲空间，需要再追加一批元素才会重新扩容。
+ * 不满足条件时按 extendRadio * extendRadio 处理；shrinkRadio 为 0 表示关闭自动缩容。
+ */
+void setShrinkPolicy(MyList* list, int shrinkRadio)
+{
+    if (shrinkRadio != 0 && shrinkRadio <= list->extendRadio)
+        shrinkRadio = list->extendRadio * list->extendRadio;
+    list->shrinkRadio = shrinkRadio;
+}
+
+
+/* 删除元素后按缩容策略释放多余的容量 */
+static void shrinkCapacity(MyList* list)
+{
+    if (list->shrinkRadio == 0)
+        return;
+
+    int newCapacity = capacity(list);
+    while (newCapacity / list->extendRadio >= MIN_CAPACITY &&
+           size(list) < newCapacity / list->shrinkRadio)
+        newCapacity /= list->extendRadio;
+
+    if (newCapacity != capacity(list))
+        resizeCapacity(list, newCapacity);
+}
+
+
+/* 把容量缩小到恰好容纳现有元素 */
+void shrinkToFit(MyList* list)
+{
+    int newCapacity = size(list) > 0 ? size(list) : 1;
+    if (newCapacity != capacity(list))
+        resizeCapacity(list, newCapacity);
+}
+
+
+/* 获取扩容过程中累计拷贝的字节数 */
+long long copiedBytes(MyList* list)
+{
+    return list->copiedBytes;
 }
 
 
@@ -72,7 +569,7 @@ int getElement(MyList* list, int index)
 {
     if (index >= 0 && index < list->size)
     {
-        return list->arr[index];
+        return list->arr[physIndex(list, index)];
     }
     
     return -1;
@@ -84,7 +581,8 @@ int setElement(MyList* list, int index, int val)
 {
     if (index >= 0 && index < list->size)
     {
-        list->arr[index] = val;
+        detachMyList(list);
+        list->arr[physIndex(list, index)] = val;
         return 0;
     }
 
@@ -95,11 +593,14 @@ int setElement(MyList* list, int index, int val)
 /* 在列表尾部追加元素 */
 void pushElement(MyList* list, int val)
 {
+    closeGap(list);
     if (size(list) == capacity(list))
         extendCapacity(list); // 扩容
+    detachMyList(list);
     
     list->arr[size(list)] = val;
     list->size++;
+    statsTrackSize(1);
 }
 
 
@@ -111,6 +612,19 @@ void insertElement(MyList* list, int index, int val)
     
     if (size(list) == capacity(list))
         extendCapacity(list);
+    detachMyList(list);
+
+    // 间隙缓冲区模式: 把间隙移到 index 处，再填充间隙的第一个位置
+    if (list->gapMode)
+    {
+        moveGap(list, index);
+        list->arr[list->gapStart] = val;
+        list->gapStart++;
+        list->gapLen--;
+        list->size++;
+        statsTrackSize(1);
+        return;
+    }
     
     for (int i = size(list); i > index; i--)
     {
@@ -118,6 +632,7 @@ void insertElement(MyList* list, int index, int val)
     }
     list->arr[index] = val;
     list->size++;
+    statsTrackSize(1);
 }
 
 
@@ -126,6 +641,19 @@ int delElement(MyList* list, int index)
 {
     if (index < 0 || index >= size(list))
         return -1;
+    detachMyList(list);
+
+    // 间隙缓冲区模式: 把间隙移到 index 处，被删除的元素并入间隙
+    if (list->gapMode)
+    {
+        moveGap(list, index);
+        int num = list->arr[list->gapStart + list->gapLen];
+        list->gapLen++;
+        list->size--;
+        statsTrackSize(-1);
+        shrinkCapacity(list);
+        return num;
+    }
     
     int num = list->arr[index];
     for (int i = index; i < size(list) - 1; i++)
@@ -133,17 +661,211 @@ int delElement(MyList* list, int index)
         list->arr[i] = list->arr[i + 1]; // 把index后的元素都向前移动一位
     }
     list->size--;
+    statsTrackSize(-1);
+    shrinkCapacity(list);
     
     return num;
 }
 
 
-/* 将列表转换为 Array 用于打印 */
+/**
+ * 在列表尾部批量追加 n 个元素
+ *
+ * 只扩容一次，再用 memcpy 一次性拷贝全部元素。
+ */
+void pushElements(MyList* list, const int* vals, int n)
+{
+    if (n <= 0)
+        return;
+
+    closeGap(list);
+    reserveCapacity(list, size(list) + n);
+    detachMyList(list);
+    memcpy(list->arr + size(list), vals, sizeof(int) * (size_t)n);
+    list->size += n;
+    statsTrackSize(n);
+}
+
+
+/**
+ * 在索引 index 处批量插入 n 个元素
+ *
+ * 逐个调用 insertElement 需要把尾部移动 n 次，时间复杂度为 O(n * size);
+ * 这里只用 memmove 把尾部整体后移 n 位，再拷贝新元素，时间复杂度为 O(n + size)。
+ */
+void insertRange(MyList* list, int index, const int* vals, int n)
+{
+    if (index < 0 || index > size(list))
+        exit(1);
+    if (n <= 0)
+        return;
+
+    closeGap(list);
+    reserveCapacity(list, size(list) + n);
+    detachMyList(list);
+    // 把 index 之后的元素整体向后移动 n 位
+    memmove(list->arr + index + n, list->arr + index,
+            sizeof(int) * (size_t)(size(list) - index));
+    memcpy(list->arr + index, vals, sizeof(int) * (size_t)n);
+    list->size += n;
+    statsTrackSize(n);
+}
+
+
+/**
+ * 删除索引区间 [index, index + n) 内的元素
+ *
+ * 尾部元素只整体向前移动一次。成功返回 0，区间越界返回 -1。
+ */
+int deleteRange(MyList* list, int index, int n)
+{
+    if (index < 0 || n < 0 || index + n > size(list))
+        return -1;
+
+    closeGap(list);
+    detachMyList(list);
+    // 把区间之后的元素整体向前移动 n 位
+    memmove(list->arr + index, list->arr + index + n,
+            sizeof(int) * (size_t)(size(list) - index - n));
+    list->size -= n;
+    statsTrackSize(-n);
+    shrinkCapacity(list);
+
+    return 0;
+}
+
+
+/**
+ * 设置元素数量
+ *
+ * 调用者直接写入 toArray 返回的数组后(例如批量生成结果、环形队列入队)，用它提交新的元素数量，
+ * 统计信息随之更新。新的元素数量不能超过容量，成功返回 0，越界返回 -1。
+ */
+int setSize(MyList* list, int newSize)
+{
+    if (newSize < 0 || newSize > capacity(list))
+        return -1;
+
+    toArray(list);
+    statsTrackSize((long long)newSize - size(list));
+    list->size = newSize;
+
+    return 0;
+}
+
+
+/* 将列表转换为可写的 Array(间隙缓冲区模式下先合并间隙，共享时先拷贝) */
 int* toArray(MyList* list)
 {
+    detachMyList(list);
+    closeGap(list);
+    return list->arr;
+}
+
+
+/* 只读访问列表的连续数组(只合并间隙，共享数组不拷贝) */
+const int* readArray(MyList* list)
+{
+    closeGap(list);
     return list->arr;
 }
 
+
+/**
+ * 把列表保存到文件
+ *
+ * 写入 ListFileHeader 和 size 个元素的原始数组。成功返回 0，失败返回 -1。
+ */
+int saveMyList(MyList* list, const char* path)
+{
+    FILE* fp = fopen(path, "wb");
+    if (fp == NULL)
+        return -1;
+
+    ListFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, LIST_FILE_MAGIC, sizeof(header.magic));
+    header.version = LIST_FILE_VERSION;
+    header.elemSize = sizeof(int);
+    header.size = (uint64_t)size(list);
+    header.capacity = (uint64_t)capacity(list);
+
+    size_t n = (size_t)size(list);
+    int ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+             fwrite(readArray(list), sizeof(int), n, fp) == n;
+
+    if (fclose(fp) != 0 || !ok)
+        return -1;
+
+    return 0;
+}
+
+
+/**
+ * 从文件加载列表
+ *
+ * 以 MAP_PRIVATE 方式映射整个文件，列表的数组直接指向文件头之后的数据:
+ * 加载时既不解析也不拷贝，物理页由内核按需从页缓存读入。
+ * 修改元素时内核只复制被写的页(写时复制)，不会改动文件本身;
+ * 追加元素导致扩容时，数据才被拷贝到堆或匿名映射中。
+ * 文件格式不匹配时返回 NULL。
+ */
+MyList* loadMyList(const char* path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    ListFileHeader header;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(header) ||
+        read(fd, &header, sizeof(header)) != (ssize_t)sizeof(header))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    // 校验文件头
+    if (memcmp(header.magic, LIST_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != LIST_FILE_VERSION || header.elemSize != sizeof(int) ||
+        header.size > (uint64_t)INT32_MAX ||
+        (uint64_t)st.st_size < sizeof(header) + header.size * sizeof(int))
+    {
+        fprintf(stderr, "Invalid list file: %s\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    MyList* list = newMyList();
+    if (header.size == 0)
+    {
+        close(fd);
+        return list;
+    }
+
+    size_t mapBytes = sizeof(header) + (size_t)header.size * sizeof(int);
+    void* base = mmap(NULL, mapBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd); // 映射建立后即可关闭文件描述符
+    if (base == MAP_FAILED)
+    {
+        destoryMyList(list);
+        return NULL;
+    }
+
+    list->arr = (int*)((char*)base + sizeof(header));
+    list->size = (int)header.size;
+    list->capacity = (int)header.size;
+#ifdef MYLIST_STATS
+    statsTrackCapacity(list, (long long)header.size - MYLIST_INLINE_SIZE);
+#endif
+    statsTrackSize((long long)header.size);
+    list->storage = STORAGE_FILE;
+    list->mapBytes = mapBytes;
+
+    return list;
+}
+
+
 /* 遍历打印数组中的值 */
 void arrPrint(int* arr, int size)
 {
@@ -155,4 +877,44 @@ void arrPrint(int* arr, int size)
             printf(", ");
     }
     printf("]\n");
-}
\ No newline at end of file
+}
+
+
+#ifdef MYLIST_STATS
+/* 获取单个列表的统计 */
+ListStats getListStats(MyList* list)
+{
+    ListStats stats = list->stats;
+    stats.capacity = capacity(list);
+    stats.slack = capacity(list) - size(list);
+
+    return stats;
+}
+
+
+/* 获取全局统计 */
+ListStats getGlobalListStats()
+{
+    ListStats stats;
+    stats.growEvents = __atomic_load_n(&globalStats.growEvents, __ATOMIC_RELAXED);
+    stats.shrinkEvents = __atomic_load_n(&globalStats.shrinkEvents, __ATOMIC_RELAXED);
+    stats.copiedBytes = __atomic_load_n(&globalStats.copiedBytes, __ATOMIC_RELAXED);
+    stats.peakCapacity = __atomic_load_n(&globalStats.peakCapacity, __ATOMIC_RELAXED);
+    stats.capacity = __atomic_load_n(&globalStats.capacity, __ATOMIC_RELAXED);
+    stats.slack = stats.capacity - __atomic_load_n(&globalSize, __ATOMIC_RELAXED);
+    stats.resizeNanos = __atomic_load_n(&globalStats.resizeNanos, __ATOMIC_RELAXED);
+
+    return stats;
+}
+
+
+/* 打印全局统计，可定期调用 */
+void dumpListStats(FILE* fp)
+{
+    ListStats stats = getGlobalListStats();
+    fprintf(fp, "MyList stats: grow=%lld shrink=%lld copied=%lldB peakCapacity=%lld "
+                "liveCapacity=%lld slack=%lld resizeTime=%.3fms\n",
+            stats.growEvents, stats.shrinkEvents, stats.copiedBytes, stats.peakCapacity,
+            stats.capacity, stats.slack, stats.resizeNanos / 1e6);
+}
+#endif
\ No newline at end of file
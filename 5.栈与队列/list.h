@@ -1,6 +1,96 @@
+#ifndef MYLIST_H
+#define MYLIST_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * 列表内部数组的存储方式
+ *
+ * 小列表使用普通堆内存，通过 realloc 扩容，分配器能原地扩展时无需拷贝;
+ * 大列表切换到 mmap 匿名映射，通过 mremap 扩容，由内核重新映射页表而不是拷贝数据。
+ * 元素不超过 MYLIST_INLINE_SIZE 个时直接存放在结构体内部，不额外分配堆内存。
+ * 从文件加载的列表直接使用文件的私有映射(写时复制)，扩容时才拷贝到堆或匿名映射中。
+ * cloneMyList 得到的列表与原列表共享同一个数组(引用计数)，第一次写入时才拷贝。
+ */
+typedef enum
+{
+    STORAGE_HEAP = 0, // malloc/realloc 分配的堆内存
+    STORAGE_MMAP,     // mmap/mremap 管理的匿名映射
+    STORAGE_INLINE,   // 结构体内部的 inlineArr
+    STORAGE_FILE,     // loadMyList 映射的文件(MAP_PRIVATE)
+    STORAGE_SHARED,   // 多个列表共享的数组(写时复制)
+} ListStorage;
+
+/**
+ * 共享数组
+ *
+ * 记录数组原本的存储方式，引用计数降为 0 时按原方式释放。
+ */
+typedef struct
+{
+    int refCount;         // 共享该数组的列表数量
+    ListStorage storage;  // 数组原本的存储方式
+    int* arr;
+    size_t mapBytes;
+} SharedArray;
+
+/**
+ * 内部数组达到该字节数后改用 mmap 存储
+ *
+ * 取 glibc 默认 M_MMAP_THRESHOLD(128KB) 的一半，留出对齐分配的额外开销:
+ * 更小的块一定由分配器在堆中分配，realloc 搬迁时一定拷贝了数据;
+ * 更大的块由列表自己通过 mmap / mremap 管理，是否拷贝都是显式的，copiedBytes 可以准确统计。
+ */
+#define MMAP_THRESHOLD (64 * 1024)
+/* 结构体内部可直接存放的元素个数，可在编译时通过 -DMYLIST_INLINE_SIZE=N 修改 */
+#ifndef MYLIST_INLINE_SIZE
+#define MYLIST_INLINE_SIZE 10
+#endif
+/**
+ * 列表文件格式(版本 1)
+ *
+ * 文件头之后紧跟 size 个元素的原始数组，字节序与写入文件的机器相同。
+ * 文件头长度是元素宽度的整数倍，映射文件后数组无需拷贝即可直接使用。
+ */
+#define LIST_FILE_MAGIC "MYLS"
+#define LIST_FILE_VERSION 1
+
+typedef struct
+{
+    char magic[4];      // 固定为 LIST_FILE_MAGIC
+    uint32_t version;   // 文件格式版本
+    uint32_t elemSize;  // 元素宽度(字节)
+    uint32_t reserved;  // 保留，写入 0
+    uint64_t size;      // 元素数量
+    uint64_t capacity;  // 保存时列表的容量
+} ListFileHeader;
+
+#ifdef MYLIST_STATS
+/**
+ * 容量调整统计(编译时定义 MYLIST_STATS 才启用，否则不产生任何开销)
+ *
+ * 用于根据真实负载调整初始容量和扩容倍数。
+ */
+typedef struct
+{
+    long long growEvents;   // 扩容次数
+    long long shrinkEvents; // 缩容次数
+    long long copiedBytes;  // 调整容量时拷贝的字节数
+    long long peakCapacity; // 容量峰值
+    long long capacity;     // 当前容量，全局统计中为所有存活列表的容量之和(共享数组只计一次)
+    long long slack;        // 当前空闲容量(容量 - 元素数量)，全局统计中为所有存活列表之和
+    long long resizeNanos;  // 调整容量花费的时间(纳秒)
+} ListStats;
+#endif
+
+/* 自动缩容时容量的下限 */
+#define MIN_CAPACITY 10
+
 /**
  * 列表类
- * 
+ *
  * 包含: 数组, 列表容量，列表大小，列表每次扩容的倍数
  */
 typedef struct
@@ -9,18 +99,54 @@ typedef struct
     int capacity;   // 列表的最大容量
     int size;       // 列表中的元素数量
     int extendRadio; // 每次扩容的倍数
+    int shrinkRadio; // 元素数量低于 容量/shrinkRadio 时缩容，0 表示不缩容
+    ListStorage storage;  // 内部数组的存储方式
+    SharedArray* shared;  // STORAGE_SHARED 时指向共享数组
+    size_t mapBytes;      // mmap / 文件存储时映射区的字节数
+    long long copiedBytes; // 扩容过程中实际拷贝的字节数
+    int gapMode;   // 是否启用间隙缓冲区模式
+    int gapStart;  // 间隙的起始物理索引
+    int gapLen;    // 间隙长度，0 表示数组是连续的
+    unsigned generation; // 内部数组搬迁或元素物理位置改变时递增，用于检测失效的视图
+#ifdef MYLIST_STATS
+    ListStats stats; // 本列表的容量调整统计
+#endif
+    int inlineArr[MYLIST_INLINE_SIZE]; // 小列表的内部存储，溢出后才转移到堆上
 } MyList;
 
 
 MyList* newMyList();
 void destoryMyList(MyList* list);
+void initMyList(MyList* list);
+void releaseMyList(MyList* list);
+MyList* cloneMyList(MyList* list);
+void detachMyList(MyList* list);
 int size(MyList* list);
 int capacity(MyList* list);
 void extendCapacity(MyList* list);
+void resizeCapacity(MyList* list, int newCapacity);
+long long copiedBytes(MyList* list);
+void setShrinkPolicy(MyList* list, int shrinkRadio);
+void shrinkToFit(MyList* list);
+void setGapBuffer(MyList* list, int enable);
 int getElement(MyList* list, int index);
 int setElement(MyList* list, int index, int val);
 void pushElement(MyList* list, int val);
 void insertElement(MyList* list, int index, int val);
 int delElement(MyList* list, int index);
+void pushElements(MyList* list, const int* vals, int n);
+void insertRange(MyList* list, int index, const int* vals, int n);
+int deleteRange(MyList* list, int index, int n);
+int setSize(MyList* list, int newSize);
 int* toArray(MyList* list);
-void arrPrint(int* arr, int size);
\ No newline at end of file
+const int* readArray(MyList* list);
+int saveMyList(MyList* list, const char* path);
+MyList* loadMyList(const char* path);
+void arrPrint(int* arr, int size);
+#ifdef MYLIST_STATS
+ListStats getListStats(MyList* list);
+ListStats getGlobalListStats();
+void dumpListStats(FILE* fp);
+#endif
+
+#endif
@@ -20,13 +20,13 @@
  * 
  * 入队:
  * 入队即在rear处赋值
- * 1. 判断队列是否满了，(list->size == list->capacity) 或 ((rear + 1) % queCapacity == front)
+ * 1. 判断队列是否满了，(size(list) == capacity(list)) 或 ((rear + 1) % queCapacity == front)
  * 2. 如果未满, 计算 rear 的值，
  * rear = (front + queSize) % queCapacity;
  * 3. 赋值
- * list->arr[rear] = value;
- * 4. 递增 queSize 和 list->size
- * queSize++, list->size++;
+ * toArray(list)[rear] = value;
+ * 4. 递增 queSize 和列表的元素数量(通过 setSize 修改，统计信息随之更新)
+ * queSize++, setSize(list, size(list) + 1);
  * 
  * 出队:
  * 即把front向后移动一位, 若越过队尾，则返回队列头部
@@ -81,6 +81,22 @@ void destroyArrayQueue(ArrayQueue* q)
     free(q);
 }
 
+/**
+ * 克隆队列
+ *
+ * 新队列与原队列共享底层数组(写时复制)，时间复杂度为 O(1)。
+ * 入队直接写入 toArray 返回的数组，它会先取得独占的数组。
+ */
+ArrayQueue* cloneArrayQueue(ArrayQueue* q)
+{
+    ArrayQueue* clone = newArrayQueue(cloneMyList(q->list));
+    clone->front = q->front;
+    clone->rear = q->rear;
+    clone->queSize = q->queSize;
+
+    return clone;
+}
+
 /* 获取队列长度 */
 int sizeArrayQueue(ArrayQueue* q)
 {
@@ -108,15 +124,16 @@ int peekArrayQueue(ArrayQueue* q)
 /* 入队 */
 void pushArrayQueue(ArrayQueue* q, int val)
 {
-    if (q->list->size == q->list->capacity) // 有效元素数量 == 队列容量
+    if (size(q->list) == capacity(q->list)) // 有效元素数量 == 队列容量
     {
         extendCapacity(q->list);
     }
     // 计算队尾指针，指向队尾索引 + 1
     // 通过取余操作实现 rear 越过数组尾部后回到头部
-    int rear = (q->front + q->queSize) % q->list->capacity;
-    q->list->arr[rear] = val;
-    q->queSize++, q->list->size++;
+    int rear = (q->front + q->queSize) % capacity(q->list);
+    toArray(q->list)[rear] = val; // 数组被克隆共享时先拷贝
+    q->queSize++;
+    setSize(q->list, size(q->list) + 1);
 }
 
 /* 出队 */
@@ -182,6 +199,12 @@ int main()
     /* 判断队列是否为空 */
     printf("队列是否为空(0假1真): %d\n\n", isEmptyArrayQueue(queue)); // 队列是否为空(0假1真): 0
 
+    /* 克隆测试: 克隆入队不影响原队列 */
+    ArrayQueue* fork = cloneArrayQueue(queue);
+    pushArrayQueue(fork, 100);
+    printf("克隆队列长度: %d, 原队列长度: %d\n\n", sizeArrayQueue(fork), sizeArrayQueue(queue)); // 100, 99
+    destroyArrayQueue(fork);
+
     /* 释放 */
     destroyArrayQueue(queue);
 
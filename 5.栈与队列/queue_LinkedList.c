@@ -1,6 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include "nodePool.h" // 节点内存池
+
+/* 编译命令: gcc queue_LinkedList.c -o queue_LinkedList */
 
 /**
  * 队列（queue）是一种遵循先入先出规则的线性数据结构。
@@ -22,11 +25,11 @@ typedef struct ListNode
     struct ListNode* next;
 } ListNode;
 
-/* 链表节点构造函数 */
-ListNode* newListNode(int val)
+/* 链表节点构造函数，pool 为 NULL 时使用 malloc */
+ListNode* newListNode(NodePool* pool, int val)
 {
     // 分配内存
-    ListNode* node = (ListNode*)malloc(sizeof(ListNode));
+    ListNode* node = pool != NULL ? (ListNode*)poolAlloc(pool) : (ListNode*)malloc(sizeof(ListNode));
     // 初始化节点
     node->next = NULL;
     node->val = val;
@@ -39,8 +42,18 @@ typedef struct
 {
     ListNode* front, *rear;
     int queSize;
+    NodePool* pool; // 节点内存池，NULL 表示使用 malloc
 } LinkedListQueue;
 
+/* 释放节点 */
+static void releaseListNode(LinkedListQueue* q, ListNode* node)
+{
+    if (q->pool != NULL)
+        poolFree(q->pool, node);
+    else
+        free(node);
+}
+
 /* 队列构造函数 */
 LinkedListQueue* newLinkedListQueue()
 {
@@ -50,6 +63,21 @@ LinkedListQueue* newLinkedListQueue()
     queue->front = NULL;
     queue->rear = NULL;
     queue->queSize = 0;
+    queue->pool = NULL;
+
+    return queue;
+}
+
+/**
+ * 使用内存池的构造函数
+ *
+ * 节点从 pool 中分配，多个栈、队列可以共享同一个内存池。销毁队列时节点放回内存池，
+ * 内存池由调用者负责销毁。
+ */
+LinkedListQueue* newLinkedListQueueWithPool(NodePool* pool)
+{
+    LinkedListQueue* queue = newLinkedListQueue();
+    queue->pool = pool;
 
     return queue;
 }
@@ -63,7 +91,7 @@ void destroyLinkedListQueue(LinkedListQueue* q)
         // 改变节点指向，然后释放节点
         ListNode* tmp = q->front;
         q->front = q->front->next;
-        free(tmp);
+        releaseListNode(q, tmp);
     }
     // 释放queue结构体
     free(q);
@@ -85,7 +113,7 @@ bool isEmptyLinkedListQueue(LinkedListQueue* q)
 void pushLinkedListQueue(LinkedListQueue* q, int val)
 {
     // 尾节点处添加 node
-    ListNode* node = newListNode(val);
+    ListNode* node = newListNode(q->pool, val);
     // 如果队列为空，则令头、尾节点都指向该节点
     if (sizeLinkedListQueue(q) == 0)
     {
@@ -127,7 +155,7 @@ int popLinkedListQueue(LinkedListQueue* q)
     // 改变头节点指向第二个节点
     ListNode* tmp = q->front;
     q->front = q->front->next;
-    free(tmp);
+    releaseListNode(q, tmp);
     q->queSize--;
 
     return val;
@@ -181,5 +209,17 @@ int main()
     /* 释放 */
     destroyLinkedListQueue(queue);
 
+    /* 使用内存池的队列: 出队的节点被之后入队的节点复用 */
+    NodePool* pool = newNodePool(sizeof(ListNode), 0);
+    LinkedListQueue* pooled = newLinkedListQueueWithPool(pool);
+    for (int i = 0; i < 100000; i++)
+    {
+        pushLinkedListQueue(pooled, i);
+        popLinkedListQueue(pooled);
+    }
+    printf("内存池 slab 数量: %lld\n", pool->slabCount); // 1
+    destroyLinkedListQueue(pooled);
+    destroyNodePool(pool);
+
     return 0;
 }
\ No newline at end of file
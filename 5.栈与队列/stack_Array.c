@@ -54,6 +54,17 @@ void destoryArrayStack(ArrayStack* s)
     free(s);
 }
 
+/**
+ * 克隆栈
+ *
+ * 新栈与原栈共享底层数组(写时复制)，时间复杂度为 O(1)，任意一方第一次修改时才拷贝元素。
+ * 适合回溯搜索中频繁分叉、但大多数分支不会修改的状态。
+ */
+ArrayStack* cloneArrayStack(ArrayStack* s)
+{
+    return newArrayStack(cloneMyList(s->list));
+}
+
 /* 判断栈是否为空 */
 bool isEmptyArrayStack(ArrayStack* s)
 {
@@ -120,6 +131,13 @@ int main(void)
     // 判断栈是否为空
     printf("栈是否为空: %d\n\n", isEmptyArrayStack(stack)); // 0 表示false
 
+    // 克隆栈: 修改克隆不影响原栈
+    ArrayStack* fork = cloneArrayStack(stack);
+    popArrayStack(fork);
+    pushArrayStack(fork, -1);
+    printf("克隆栈顶元素: %d, 原栈顶元素: %d\n\n", peekArrayStack(fork), peekArrayStack(stack)); // -1, 98
+    destoryArrayStack(fork);
+
     // 销毁栈
     destoryArrayStack(stack);
 
@@ -1,6 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include "nodePool.h" // 节点内存池
+
+/* 编译命令: gcc stack_LinkedList.c -o stack_LinkedList */
 
 /**
  * 栈（stack）是一种遵循先入后出逻辑的线性数据结构。
@@ -36,6 +39,7 @@ typedef struct
 {
     ListNode* top; // 将头节点作为栈顶
     int size; // 栈的长度
+    NodePool* pool; // 节点内存池，NULL 表示使用 malloc
 } LinkedListStack;
 
 /* 构造函数 */
@@ -46,10 +50,42 @@ LinkedListStack* newLinkedListStack()
     // 初始化
     s->top = NULL;
     s->size = 0;
+    s->pool = NULL;
+
+    return s;
+}
+
+/**
+ * 使用内存池的构造函数
+ *
+ * 节点从 pool 中分配，多个栈、队列可以共享同一个内存池。销毁栈时节点放回内存池，
+ * 内存池由调用者负责销毁。
+ */
+LinkedListStack* newLinkedListStackWithPool(NodePool* pool)
+{
+    LinkedListStack* s = newLinkedListStack();
+    s->pool = pool;
 
     return s;
 }
 
+/* 分配节点 */
+static ListNode* allocNode(LinkedListStack* stack)
+{
+    if (stack->pool != NULL)
+        return (ListNode*)poolAlloc(stack->pool);
+    return (ListNode*)malloc(sizeof(ListNode));
+}
+
+/* 释放节点 */
+static void releaseNode(LinkedListStack* stack, ListNode* node)
+{
+    if (stack->pool != NULL)
+        poolFree(stack->pool, node);
+    else
+        free(node);
+}
+
 /* 析构函数 */
 void destoryLinkedListStack(LinkedListStack* stack)
 {
@@ -58,7 +94,7 @@ void destoryLinkedListStack(LinkedListStack* stack)
         // 拿到栈顶下面的那个节点
         ListNode* n = stack->top->next;
         // 释放掉栈顶元素
-        free(stack->top);
+        releaseNode(stack, stack->top);
         // 使头节点指向第二个节点
         stack->top = n;
     }
@@ -81,7 +117,7 @@ bool isEmpty(LinkedListStack* stack)
 /* 入栈 */
 void push(LinkedListStack* stack, int val)
 {
-    ListNode* node = (ListNode*)malloc(sizeof(ListNode));
+    ListNode* node = allocNode(stack);
     // 更新新加节点指针域
     node->next = stack->top;
     // 更新新加节点数据域
@@ -113,7 +149,7 @@ int pop(LinkedListStack* stack)
     stack->top = stack->top->next;
 
     // 释放内存
-    free(tmp);
+    releaseNode(stack, tmp);
     stack->size--;
 
     return val;
@@ -151,5 +187,16 @@ int main()
     // 销毁栈
     destoryLinkedListStack(stack);
 
+    // 使用内存池的栈
+    NodePool* pool = newNodePool(sizeof(ListNode), 0);
+    LinkedListStack* pooled = newLinkedListStackWithPool(pool);
+    for (int i = 0; i < 100000; i++)
+        push(pooled, i);
+    for (int i = 0; i < 50000; i++)
+        pop(pooled);
+    printf("内存池栈顶元素: %d, 栈长度: %d\n", peek(pooled), size(pooled)); // 49999, 50000
+    destoryLinkedListStack(pooled);
+    destroyNodePool(pool);
+
     return 0;
 }
\ No newline at end of file
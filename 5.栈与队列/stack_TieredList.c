@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "tieredList.h" // 分层向量实现
+
+// 编译命令: gcc stack_TieredList.c tieredList.c -o stack_TieredList
+
+/**
+ * 3. 基于分层向量实现栈
+ * 分层向量的接口与 list.h 一一对应，把 stack_Array.c 中的 MyList 换成 TieredList 即可。
+ * 栈顶在尾部，入栈与出栈只涉及最后一块，时间复杂度仍为 O(1)。
+ */
+
+/* 基于分层向量实现的栈 */
+
+typedef struct
+{
+    TieredList* list;
+    int size;
+} TieredStack;
+
+/* 构造函数 */
+TieredStack* newTieredStack(TieredList* list)
+{
+    // 分配内存
+    TieredStack* s = malloc(sizeof(TieredStack));
+    // 初始化栈
+    s->list = list;
+    s->size = sizeTieredList(s->list);
+
+    return s;
+}
+
+/* 析构函数 */
+void destoryTieredStack(TieredStack* s)
+{
+    destoryTieredList(s->list);
+
+    free(s);
+}
+
+/* 判断栈是否为空 */
+bool isEmptyTieredStack(TieredStack* s)
+{
+    return s->size == 0;
+}
+
+/* 入栈 */
+void pushTieredStack(TieredStack* s, int val)
+{
+    pushElementTieredList(s->list, val);
+    s->size = sizeTieredList(s->list);
+}
+
+/* 访问栈顶元素 */
+int peekTieredStack(TieredStack* s)
+{
+    if (isEmptyTieredStack(s))
+    {
+        printf("栈为空\n");
+        return INT8_MAX;
+    }
+
+    return getElementTieredList(s->list, s->size - 1);
+}
+
+/* 出栈 */
+int popTieredStack(TieredStack* s)
+{
+    if (isEmptyTieredStack(s))
+    {
+        printf("栈为空\n");
+        return INT8_MAX;
+    }
+
+    int val = delElementTieredList(s->list, sizeTieredList(s->list) - 1);
+    s->size = sizeTieredList(s->list);
+
+    return val;
+}
+
+
+
+int main(void)
+{
+    TieredList* list = newTieredList();
+    TieredStack* stack = newTieredStack(list);
+
+    // 添加元素
+    for(int i = 0; i < 100; i++)
+    {
+        pushTieredStack(stack, i);
+    }
+    printf("栈顶元素: %d\n", peekTieredStack(stack)); // 99
+    printf("栈长度: %d\n\n", stack->size); // 100
+
+    // 出栈
+    popTieredStack(stack);
+    printf("栈顶元素: %d\n", peekTieredStack(stack)); // 98
+    printf("栈长度: %d\n\n", stack->size); // 99
+
+    // 判断栈是否为空
+    printf("栈是否为空: %d\n\n", isEmptyTieredStack(stack)); // 0 表示false
+
+    // 销毁栈
+    destoryTieredStack(stack);
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "tieredList.h"
+
+/**
+ * 分层向量
+ *
+ * MyList 在中间插入、删除元素时需要移动其后的全部元素，时间复杂度为 O(n)。
+ * 分层向量把元素分散到大小为 B 的环形块中，除最后一块外每块都是满的:
+ * 1. 访问: 第 i 个元素位于第 i / B 块的第 i % B 个位置，B 为 2 的幂，只需移位和取掩码，O(1)。
+ * 2. 插入: 在目标块内移动 O(B) 个元素，块中溢出的末尾元素放到下一块的头部。
+ *    环形块在头部添加元素只需把偏移减 1，因此后面每一块只需 O(1)，共 O(B + n / B)。
+ * 3. 删除: 与插入对称，后面每一块把头部元素交给前一块的尾部。
+ * 块大小随元素数量调整，保持 B 约等于 sqrt(n)，插入和删除的时间复杂度为 O(sqrt(n))。
+ *
+ * 接口与 list.h 一一对应(函数名加 TieredList 后缀)，栈和队列可以直接换用。
+ */
+
+#define MIN_BLOCK_SIZE 16
+
+/* 块 b 中第 j 个元素的地址 */
+static inline int* slot(TieredList* list, int b, int j)
+{
+    return &list->blocks[b][(list->offsets[b] + j) & (list->blockSize - 1)];
+}
+
+/* 按块大小 blockSize 初始化空的块结构 */
+static void initBlocks(TieredList* list, int blockSize)
+{
+    list->blockSize = blockSize;
+    list->shift = __builtin_ctz(blockSize);
+    list->blockCap = 4;
+    list->numBlocks = 0;
+    list->blocks = malloc(sizeof(int*) * list->blockCap);
+    list->offsets = malloc(sizeof(int) * list->blockCap);
+    if (list->blocks == NULL || list->offsets == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+}
+
+/* 释放所有块 */
+static void freeBlocks(TieredList* list)
+{
+    for (int b = 0; b < list->numBlocks; b++)
+        free(list->blocks[b]);
+    free(list->blocks);
+    free(list->offsets);
+}
+
+/* 在末尾追加一个空块 */
+static void addBlock(TieredList* list)
+{
+    if (list->numBlocks == list->blockCap)
+    {
+        list->blockCap *= 2;
+        list->blocks = realloc(list->blocks, sizeof(int*) * list->blockCap);
+        list->offsets = realloc(list->offsets, sizeof(int) * list->blockCap);
+    }
+    int* block = malloc(sizeof(int) * list->blockSize);
+    if (list->blocks == NULL || list->offsets == NULL || block == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+    list->blocks[list->numBlocks] = block;
+    list->offsets[list->numBlocks] = 0;
+    list->numBlocks++;
+}
+
+/* 适合 n 个元素的块大小: 满足 2 * B * B >= n 的最小的 2 的幂，不小于 MIN_BLOCK_SIZE */
+static int fitBlockSize(int n)
+{
+    int blockSize = MIN_BLOCK_SIZE;
+    while (2LL * blockSize * blockSize < n)
+        blockSize *= 2;
+
+    return blockSize;
+}
+
+/* 用新的块大小重建列表，时间复杂度 O(n)，由块大小翻倍/减半分摊 */
+static void rebuild(TieredList* list, int blockSize)
+{
+    TieredList old = *list;
+    initBlocks(list, blockSize);
+    list->size = 0;
+
+    for (int i = 0; i < old.size; i++)
+    {
+        if ((list->size & (blockSize - 1)) == 0)
+            addBlock(list);
+        *slot(list, list->numBlocks - 1, list->size & (blockSize - 1)) =
+            *slot(&old, i >> old.shift, i & (old.blockSize - 1));
+        list->size++;
+    }
+    freeBlocks(&old);
+}
+
+
+/* 构造函数 */
+TieredList* newTieredList()
+{
+    TieredList* list = malloc(sizeof(TieredList));
+    initBlocks(list, MIN_BLOCK_SIZE);
+    list->size = 0;
+
+    return list;
+}
+
+/* 析构函数 */
+void destoryTieredList(TieredList* list)
+{
+    if (list != NULL)
+    {
+        freeBlocks(list);
+        free(list);
+    }
+}
+
+/* 获取列表长度 */
+int sizeTieredList(TieredList* list)
+{
+    return list->size;
+}
+
+/* 获取列表容量(已分配的块能容纳的元素个数) */
+int capacityTieredList(TieredList* list)
+{
+    return list->numBlocks * list->blockSize;
+}
+
+/* 访问元素 */
+int getElementTieredList(TieredList* list, int index)
+{
+    if (index >= 0 && index < list->size)
+        return *slot(list, index >> list->shift, index & (list->blockSize - 1));
+
+    return -1;
+}
+
+/* 更新元素 */
+int setElementTieredList(TieredList* list, int index, int val)
+{
+    if (index >= 0 && index < list->size)
+    {
+        *slot(list, index >> list->shift, index & (list->blockSize - 1)) = val;
+        return 0;
+    }
+
+    return -1;
+}
+
+/* 在列表中插入元素 */
+void insertElementTieredList(TieredList* list, int index, int val)
+{
+    if (index < 0 || index > list->size)
+        exit(1);
+
+    // toArrayTieredList 合并成一块之后，先恢复到适合当前元素数量的块大小
+    if (list->blockSize > MIN_BLOCK_SIZE && list->numBlocks < list->blockSize / 4)
+        rebuild(list, fitBlockSize(list->size));
+
+    int mask = list->blockSize - 1;
+    if ((list->size & mask) == 0 && (list->size >> list->shift) == list->numBlocks)
+        addBlock(list); // 所有块都满了
+
+    int b = index >> list->shift;
+    int last = list->size >> list->shift; // 第一个空位所在的块
+
+    // 从最后一块开始，每块在头部接收前一块的末尾元素
+    // 前一块是满的环形块，头部前一格正是它的末尾，因此接着对前一块做头部插入会覆盖这个已移走的元素
+    for (int k = last; k > b; k--)
+    {
+        int back = *slot(list, k - 1, mask);
+        list->offsets[k] = (list->offsets[k] - 1) & mask;
+        *slot(list, k, 0) = back;
+    }
+
+    // 目标块内把 [j, count - 1) 向后移动一位(末尾位置已空出或本来就是空位)
+    int j = index & mask;
+    int count = (b == last) ? (list->size & mask) + 1 : list->blockSize;
+    for (int t = count - 1; t > j; t--)
+        *slot(list, b, t) = *slot(list, b, t - 1);
+    *slot(list, b, j) = val;
+    list->size++;
+
+    // 块数量过多时增大块大小，保持 blockSize 约为 sqrt(n)
+    if (list->numBlocks > 2 * list->blockSize)
+        rebuild(list, list->blockSize * 2);
+}
+
+/* 在列表尾部追加元素 */
+void pushElementTieredList(TieredList* list, int val)
+{
+    insertElementTieredList(list, list->size, val);
+}
+
+/* 删除元素 */
+int delElementTieredList(TieredList* list, int index)
+{
+    if (index < 0 || index >= list->size)
+        return -1;
+
+    int mask = list->blockSize - 1;
+    int b = index >> list->shift;
+    int last = (list->size - 1) >> list->shift; // 最后一个元素所在的块
+    int j = index & mask;
+    int count = (b == last) ? ((list->size - 1) & mask) + 1 : list->blockSize;
+
+    // 目标块内把 (j, count) 向前移动一位
+    int num = *slot(list, b, j);
+    for (int t = j; t < count - 1; t++)
+        *slot(list, b, t) = *slot(list, b, t + 1);
+
+    // 之后每块把头部元素交给前一块的末尾
+    for (int k = b + 1; k <= last; k++)
+    {
+        *slot(list, k - 1, mask) = *slot(list, k, 0);
+        list->offsets[k] = (list->offsets[k] + 1) & mask;
+    }
+    list->size--;
+
+    // 释放已经空了的最后一块
+    if ((list->size & mask) == 0 && list->numBlocks > (list->size >> list->shift))
+    {
+        list->numBlocks--;
+        free(list->blocks[list->numBlocks]);
+    }
+
+    // 块数量过少时减小块大小
+    if (list->blockSize > MIN_BLOCK_SIZE && list->numBlocks < list->blockSize / 4)
+        rebuild(list, fitBlockSize(list->size));
+
+    return num;
+}
+
+/**
+ * 将列表转换为可写的 Array
+ *
+ * 把所有元素合并到一个从头开始存放的块中并返回它，时间复杂度 O(n)，与 MyList 合并间隙缓冲区相同。
+ * 返回的数组由列表持有，下一次插入或删除时失效；之后第一次插入或删除会把块大小恢复为 O(sqrt(n))。
+ */
+int* toArrayTieredList(TieredList* list)
+{
+    if (list->numBlocks > 1 || (list->numBlocks == 1 && list->offsets[0] != 0))
+    {
+        int blockSize = MIN_BLOCK_SIZE;
+        while (blockSize < list->size)
+            blockSize *= 2;
+        rebuild(list, blockSize);
+    }
+    if (list->numBlocks == 0)
+        addBlock(list);
+
+    return list->blocks[0];
+}